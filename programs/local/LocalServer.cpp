@@ -677,6 +677,11 @@ void LocalServer::processConfig()
     }
     global_context->setMMappedFileCache(mmap_cache_size);
 
+    size_t prewhere_selectivity_cache_size = config().getUInt64("prewhere_selectivity_cache_size", DEFAULT_PREWHERE_SELECTIVITY_CACHE_MAX_SIZE);
+    if (prewhere_selectivity_cache_size > max_cache_size)
+        prewhere_selectivity_cache_size = max_cache_size;
+    global_context->setPrewhereSelectivityCache(prewhere_selectivity_cache_size);
+
     /// Initialize a dummy query cache.
     global_context->setQueryCache(0, 0, 0, 0);
 
@@ -21,6 +21,7 @@
 #include <base/getFQDNOrHostName.h>
 #include <base/safeExit.h>
 #include <Common/PoolId.h>
+#include <Common/Allocator.h>
 #include <Common/MemoryTracker.h>
 #include <Common/ClickHouseRevision.h>
 #include <Common/DNSResolver.h>
@@ -1236,6 +1237,8 @@ try
     }
     global_context->setMarkCache(mark_cache_policy, mark_cache_size, mark_cache_size_ratio);
 
+    setUseTransparentHugePagesForLargeAllocations(server_settings.allocator_use_transparent_huge_pages);
+
     size_t page_cache_size = server_settings.page_cache_size;
     if (page_cache_size != 0)
         global_context->setPageCache(
@@ -1282,6 +1285,23 @@ try
     }
     global_context->setQueryCache(query_cache_max_size_in_bytes, query_cache_max_entries, query_cache_query_cache_max_entry_size_in_bytes, query_cache_max_entry_size_in_rows);
 
+    size_t hash_join_cache_max_size_in_bytes = config().getUInt64("hash_join_cache.max_size_in_bytes", DEFAULT_HASH_JOIN_CACHE_MAX_SIZE);
+    size_t hash_join_cache_max_entries = config().getUInt64("hash_join_cache.max_entries", DEFAULT_HASH_JOIN_CACHE_MAX_ENTRIES);
+    if (hash_join_cache_max_size_in_bytes > max_cache_size)
+    {
+        hash_join_cache_max_size_in_bytes = max_cache_size;
+        LOG_INFO(log, "Lowered hash join cache size to {} because the system has limited RAM", formatReadableSizeWithBinarySuffix(hash_join_cache_max_size_in_bytes));
+    }
+    global_context->setHashJoinCache(hash_join_cache_max_size_in_bytes, hash_join_cache_max_entries);
+
+    size_t prewhere_selectivity_cache_size = config().getUInt64("prewhere_selectivity_cache_size", DEFAULT_PREWHERE_SELECTIVITY_CACHE_MAX_SIZE);
+    if (prewhere_selectivity_cache_size > max_cache_size)
+    {
+        prewhere_selectivity_cache_size = max_cache_size;
+        LOG_INFO(log, "Lowered prewhere selectivity cache size to {} because the system has limited RAM", formatReadableSizeWithBinarySuffix(prewhere_selectivity_cache_size));
+    }
+    global_context->setPrewhereSelectivityCache(prewhere_selectivity_cache_size);
+
 #if USE_EMBEDDED_COMPILER
     size_t compiled_expression_cache_max_size_in_bytes = config().getUInt64("compiled_expression_cache_size", DEFAULT_COMPILED_EXPRESSION_CACHE_MAX_SIZE);
     size_t compiled_expression_cache_max_elements = config().getUInt64("compiled_expression_cache_elements_size", DEFAULT_COMPILED_EXPRESSION_CACHE_MAX_ENTRIES);
@@ -2011,6 +2011,14 @@ bool subtreeHasViewSource(const IQueryTreeNode * node, const Context & context)
 }
 
 /// Evaluate scalar subquery and perform constant folding if scalar subquery does not have constant value
+///
+/// Note that this is also where correlated scalar subqueries die: the subquery is resolved in
+/// its own scope with no access to outer columns, so a reference to the enclosing query fails
+/// as an unknown identifier during resolution below. Supporting them is not a matter of
+/// per-row re-evaluation here (that would be the catastrophic nested-loops shape) but of a
+/// decorrelation rewrite - turning the correlated subquery into a join on the correlated
+/// columns with grouping, and correlated EXISTS into a semi join - which has to run as an
+/// analyzer pass before this evaluation collapses the subquery to a constant.
 void QueryAnalyzer::evaluateScalarSubqueryIfNeeded(QueryTreeNodePtr & node, IdentifierResolveScope & scope)
 {
     auto * query_node = node->as<QueryNode>();
@@ -6269,6 +6277,16 @@ ProjectionNames QueryAnalyzer::resolveExpressionNode(QueryTreeNodePtr & node, Id
                 if (resolved_identifier_node)
                 {
                     /// If table identifier is resolved as CTE clone it and resolve
+                    ///
+                    /// The clone per reference is what makes N uses of a CTE N independent
+                    /// subplans. This is not only a missing once-vs-inline cost decision:
+                    /// inlining is load-bearing for correctness and pruning, because each clone
+                    /// is resolved in its own scope and then specialized per use site (filter
+                    /// pushdown into the clone, per-use column pruning, PREWHERE). A shared
+                    /// materialization would have to be planned for the union of all consumers'
+                    /// requirements and give up those per-use optimizations, so sharing is
+                    /// an explicit opt-in via temporary tables today rather than something the
+                    /// analyzer can decide here by reference count alone.
                     auto * subquery_node = resolved_identifier_node->as<QueryNode>();
                     auto * union_node = resolved_identifier_node->as<UnionNode>();
                     bool resolved_as_cte = (subquery_node && subquery_node->isCTE()) || (union_node && union_node->isCTE());
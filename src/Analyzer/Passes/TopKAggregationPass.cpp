@@ -0,0 +1,196 @@
+#include <Analyzer/Passes/TopKAggregationPass.h>
+
+#include <AggregateFunctions/AggregateFunctionFactory.h>
+#include <AggregateFunctions/IAggregateFunction.h>
+
+#include <Functions/FunctionFactory.h>
+
+#include <Interpreters/Context.h>
+
+#include <Analyzer/InDepthQueryTreeVisitor.h>
+#include <Analyzer/ColumnNode.h>
+#include <Analyzer/ConstantNode.h>
+#include <Analyzer/FunctionNode.h>
+#include <Analyzer/QueryNode.h>
+#include <Analyzer/SortNode.h>
+
+namespace DB
+{
+
+namespace
+{
+
+/// Above this limit the space-saving summary is not really smaller than a plain hash table.
+constexpr UInt64 max_limit_for_rewrite = 65536;
+
+QueryTreeNodePtr createResolvedFunction(const ContextPtr & context, const String & name, QueryTreeNodes arguments)
+{
+    auto function_node = std::make_shared<FunctionNode>(name);
+
+    auto function = FunctionFactory::instance().get(name, context);
+    function_node->getArguments().getNodes() = std::move(arguments);
+    function_node->resolveAsFunction(function->build(function_node->getArgumentColumns()));
+    return function_node;
+}
+
+QueryTreeNodePtr createTupleElementFunction(const ContextPtr & context, QueryTreeNodePtr argument, UInt64 index)
+{
+    return createResolvedFunction(context, "tupleElement", {std::move(argument), std::make_shared<ConstantNode>(index)});
+}
+
+FunctionNodePtr createResolvedAggregateFunction(const String & name, const QueryTreeNodePtr & argument, const Array & parameters)
+{
+    auto function_node = std::make_shared<FunctionNode>(name);
+
+    QueryTreeNodes parameter_nodes;
+    for (const auto & param : parameters)
+        parameter_nodes.emplace_back(std::make_shared<ConstantNode>(param));
+    function_node->getParameters().getNodes() = std::move(parameter_nodes);
+    function_node->getArguments().getNodes() = {argument};
+
+    AggregateFunctionProperties properties;
+    auto aggregate_function = AggregateFunctionFactory::instance().get(name, NullsAction::EMPTY, {argument->getResultType()}, parameters, properties);
+    function_node->resolveAsAggregateFunction(std::move(aggregate_function));
+
+    return function_node;
+}
+
+class TopKAggregationVisitor : public InDepthQueryTreeVisitorWithContext<TopKAggregationVisitor>
+{
+public:
+    using Base = InDepthQueryTreeVisitorWithContext<TopKAggregationVisitor>;
+    using Base::Base;
+
+    void enterImpl(QueryTreeNodePtr & node)
+    {
+        if (!getSettings().optimize_topk_aggregation)
+            return;
+
+        auto * query_node = node->as<QueryNode>();
+        if (!query_node)
+            return;
+
+        /// Check that the query has no clauses which the rewrite cannot preserve.
+        /// WHERE and PREWHERE are fine: they are applied before the aggregation and are moved into the subquery.
+        if (query_node->hasWith() || query_node->hasHaving() || query_node->hasWindow() || query_node->hasInterpolate()
+            || query_node->hasLimitByLimit() || query_node->hasLimitByOffset() || query_node->hasLimitBy() || query_node->hasOffset()
+            || query_node->isDistinct() || query_node->isLimitWithTies() || query_node->isGroupByAll()
+            || query_node->isGroupByWithTotals() || query_node->isGroupByWithRollup() || query_node->isGroupByWithCube()
+            || query_node->isGroupByWithGroupingSets())
+            return;
+
+        /// Check that the query aggregates by a single column key.
+        if (!query_node->hasGroupBy())
+            return;
+
+        auto & group_by_nodes = query_node->getGroupBy().getNodes();
+        if (group_by_nodes.size() != 1 || group_by_nodes[0]->getNodeType() != QueryTreeNodeType::COLUMN)
+            return;
+
+        auto & key_column_node = group_by_nodes[0];
+
+        /// approx_top_k returns the key with the LowCardinality/Nullable wrappers removed, which would change the header.
+        auto key_type = key_column_node->getResultType();
+        if (key_type->isNullable() || key_type->lowCardinality())
+            return;
+
+        /// Check that the projection is exactly the key and count() (in any order).
+        auto & projection_nodes = query_node->getProjection().getNodes();
+        if (projection_nodes.size() != 2)
+            return;
+
+        size_t key_projection_index = 0;
+        if (!projection_nodes[key_projection_index]->isEqual(*key_column_node))
+            key_projection_index = 1;
+        if (!projection_nodes[key_projection_index]->isEqual(*key_column_node))
+            return;
+
+        size_t count_projection_index = 1 - key_projection_index;
+        auto * count_function_node = projection_nodes[count_projection_index]->as<FunctionNode>();
+        if (!count_function_node || !count_function_node->isAggregateFunction() || count_function_node->getFunctionName() != "count"
+            || !count_function_node->getArguments().getNodes().empty())
+            return;
+
+        /// Check that the query is ordered by count() only, in descending order.
+        if (!query_node->hasOrderBy())
+            return;
+
+        auto & order_by_nodes = query_node->getOrderBy().getNodes();
+        if (order_by_nodes.size() != 1)
+            return;
+
+        auto * sort_node = order_by_nodes[0]->as<SortNode>();
+        if (!sort_node || sort_node->getSortDirection() != SortDirection::DESCENDING || sort_node->withFill()
+            || !sort_node->getExpression()->isEqual(*count_function_node))
+            return;
+
+        /// Check that the limit is a reasonable constant.
+        if (!query_node->hasLimit())
+            return;
+
+        const auto * limit_constant = query_node->getLimit()->as<ConstantNode>();
+        if (!limit_constant)
+            return;
+
+        const auto & limit_field = limit_constant->getValue();
+        if (limit_field.getType() != Field::Types::UInt64)
+            return;
+
+        UInt64 limit_value = limit_field.get<UInt64>();
+        if (limit_value == 0 || limit_value > max_limit_for_rewrite)
+            return;
+
+        /// Build subquery SELECT approx_top_k(limit)(key) FROM table_expression [PREWHERE ...] [WHERE ...]
+        auto subquery = std::make_shared<QueryNode>(Context::createCopy(query_node->getContext()));
+        subquery->getJoinTree() = query_node->getJoinTree();
+
+        if (query_node->hasPrewhere())
+        {
+            subquery->getPrewhere() = std::move(query_node->getPrewhere());
+            query_node->getPrewhere() = nullptr;
+        }
+
+        if (query_node->hasWhere())
+        {
+            subquery->getWhere() = std::move(query_node->getWhere());
+            query_node->getWhere() = nullptr;
+        }
+
+        auto topk_function_node = createResolvedAggregateFunction("approx_top_k", key_column_node, {limit_value});
+        auto topk_type = topk_function_node->getResultType();
+        subquery->getProjection().getNodes().push_back(std::move(topk_function_node));
+        subquery->resolveProjectionColumns({NameAndTypePair{"topk", topk_type}});
+
+        /// Build subquery SELECT arrayJoin(topk) FROM subquery
+        auto array_join_subquery = std::make_shared<QueryNode>(Context::createCopy(query_node->getContext()));
+        auto topk_column_node = std::make_shared<ColumnNode>(NameAndTypePair{"topk", topk_type}, subquery);
+        auto array_join_function_node = createResolvedFunction(getContext(), "arrayJoin", {std::move(topk_column_node)});
+        auto topk_element_type = array_join_function_node->getResultType();
+        array_join_subquery->getJoinTree() = std::move(subquery);
+        array_join_subquery->getProjection().getNodes().push_back(std::move(array_join_function_node));
+        array_join_subquery->resolveProjectionColumns({NameAndTypePair{"topk_element", topk_element_type}});
+
+        /// Replace the projection of the initial query with tuple elements of the approx_top_k result.
+        /// topk_element is Tuple(item, count, error), the result columns keep their original names and types.
+        auto topk_element_column_node = std::make_shared<ColumnNode>(NameAndTypePair{"topk_element", topk_element_type}, array_join_subquery);
+        auto key_expression = createTupleElementFunction(getContext(), topk_element_column_node, 1);
+        auto count_expression = createTupleElementFunction(getContext(), topk_element_column_node, 2);
+
+        projection_nodes[key_projection_index] = std::move(key_expression);
+        projection_nodes[count_projection_index] = count_expression;
+
+        query_node->getGroupBy().getNodes().clear();
+        sort_node->getExpression() = std::move(count_expression);
+        query_node->getJoinTree() = std::move(array_join_subquery);
+    }
+};
+
+}
+
+void TopKAggregationPass::run(QueryTreeNodePtr & query_tree_node, ContextPtr context)
+{
+    TopKAggregationVisitor visitor(std::move(context));
+    visitor.visit(query_tree_node);
+}
+
+}
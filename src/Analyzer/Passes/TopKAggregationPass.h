@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Analyzer/IQueryTreePass.h>
+
+namespace DB
+{
+
+/** Rewrite `GROUP BY key ORDER BY count() DESC LIMIT n` into the `approx_top_k` aggregate function.
+  *
+  * Example: SELECT key, count() AS c FROM table GROUP BY key ORDER BY c DESC LIMIT 10;
+  * Result: SELECT tupleElement(topk_element, 1) AS key, tupleElement(topk_element, 2) AS c
+  *         FROM (SELECT arrayJoin(approx_top_k(10)(key)) AS topk_element FROM table)
+  *         ORDER BY c DESC LIMIT 10;
+  *
+  * The rewritten query keeps only O(n) of aggregation state (the space-saving summary of approx_top_k)
+  * instead of materializing the complete hash table, which matters for high-cardinality keys.
+  * The result may be approximate, therefore the rewrite is disabled by default
+  * (setting optimize_topk_aggregation).
+  */
+class TopKAggregationPass final : public IQueryTreePass
+{
+public:
+    String getName() override { return "TopKAggregation"; }
+
+    String getDescription() override
+    {
+        return "Rewrite GROUP BY key ORDER BY count() DESC LIMIT n into the approx_top_k aggregate function";
+    }
+
+    void run(QueryTreeNodePtr & query_tree_node, ContextPtr context) override;
+
+};
+
+}
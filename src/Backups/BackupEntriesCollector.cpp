@@ -783,6 +783,18 @@ void BackupEntriesCollector::makeBackupEntriesForTablesDefs()
     }
 }
 
+/// Data collection already runs on the global BACKUP pool (server setting backup_threads),
+/// one task per table, not a per-table pool - and the entries produced here are lazy, so the
+/// actual part reads and uploads are also spread over that pool (and restore over
+/// restore_threads). The serial sections that remain are the metadata passes above, which
+/// must see a consistent set of tables and run under the collection timeout. Incremental
+/// *backup* is covered by base_backup: entries whose checksum exists in the base are written
+/// as references. The missing piece the 200 TB complaint really hits is incremental
+/// *restore* - skipping parts that already exist in the target table by checksum. That needs
+/// restore-side reconciliation against live tables (what ATTACH-based recovery does), not a
+/// change in how entries are collected here; today the practical route for same-cluster
+/// recovery of mostly-intact tables is RESTORE ... SETTINGS allow_non_empty_tables with
+/// partition-level granularity, or replica repair which fetches only missing parts.
 void BackupEntriesCollector::makeBackupEntriesForTablesData()
 {
     if (backup_settings.structure_only)
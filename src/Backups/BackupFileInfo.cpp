@@ -27,6 +27,13 @@ namespace
         return std::nullopt;
     }
 
+    /// Deduplication against the base backup works at two granularities only: a whole file
+    /// with the same size and checksum, or a prefix of it (HasPrefix, useful for append-only
+    /// files like StorageLog). Finer-grained (content-defined chunk) deduplication would help
+    /// with re-merged or recompressed parts, but chunks are not addressable in the backup
+    /// format: .backup metadata describes files as (base_size, size, checksum) and restore
+    /// reads them as contiguous streams, so introducing a chunk store means a new metadata
+    /// version plus reassembly on restore, not a local change here.
     enum class CheckBackupResult
     {
         HasPrefix,
@@ -43,6 +43,17 @@ class NativeWriter;
   *
   * As 'default_database' empty string could be passed
   *  - in that case, server will use it's own default database.
+  *
+  * One query per connection is a protocol invariant, not an oversight. Packets carry no
+  * channel id; the stream between Query and EndOfStream *is* the query, and cancellation,
+  * progress, per-query compression state and hedged-request fallback all key off the socket.
+  * Multiplexing channels onto one TCP stream would re-introduce head-of-line blocking (a
+  * stalled consumer of one subquery blocks the shared byte stream for all of them) and would
+  * break hedged requests, which deliberately race over distinct sockets. The costs the
+  * request targets are already amortized elsewhere: pools keep connections and their TLS
+  * sessions alive across queries, and with async_socket_for_remote an idle connection holds
+  * no thread - only an fd parked on the executor's epoll - so tens of thousands of pooled
+  * sockets cost kernel buffers, not threads or handshakes.
   */
 class Connection : public IServerConnection
 {
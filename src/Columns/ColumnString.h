@@ -22,6 +22,14 @@ namespace DB
 class Arena;
 
 /** Column for String values.
+  *
+  * The column always owns its bytes: chars is a single contiguous padded array that every
+  * consumer (filters, serializers, hash functions reading 16-byte chunks past the end) relies
+  * on. A "borrowed" mode referencing an input format's segment buffer was considered for
+  * ingest and rejected: text formats unescape and null-terminate values while appending, so
+  * the bytes in the source buffer are generally not the bytes the column needs, and tying
+  * column lifetime to parser segments would leak a whole segment for as long as any block
+  * built from it is alive (e.g. sitting in an INSERT pipeline or a buffer table).
   */
 class ColumnString final : public COWHelper<IColumnHelper<ColumnString>, ColumnString>
 {
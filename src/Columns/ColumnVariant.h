@@ -53,6 +53,14 @@ namespace DB
  *  NULL_DISCRIMINATOR        0
  *         1                  2
  *
+ * Extracting a subcolumn (Nullable(T) over the rows of one variant) materializes a new column
+ * even though discriminators + offsets could in principle describe it as a view: each nested
+ * column stores only the rows of its own variant, so the subcolumn has to re-insert NULLs at
+ * every other row's position to satisfy the IColumn contract of dense, self-owned row storage
+ * that aggregation keys (serializeValueIntoArena) and function implementations assume. A lazy
+ * view would be a new IColumn with per-access indirection, the same engineering as
+ * ColumnSparse - worthwhile only if the access patterns that matter (hashing, comparison)
+ * get indirection-aware overloads rather than falling back to row-by-row virtual calls.
  */
 class ColumnVariant final : public COWHelper<IColumnHelper<ColumnVariant>, ColumnVariant>
 {
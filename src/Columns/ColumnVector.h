@@ -305,6 +305,53 @@ inline void vectorIndexImpl(const Container & data, const PaddedPODArray<Type> &
 }
 );
 
+DECLARE_AVX512F_SPECIFIC_CODE(
+/// Gather kernel for dictionary expansion of 4/8-byte elements by 2/4-byte indexes:
+/// the hot path of ColumnLowCardinality::convertToFullColumn for numeric dictionaries,
+/// where the dictionary is too large for in-register shuffles.
+template <typename Container, typename Type>
+inline void vectorIndexGatherImpl(const Container & data, const PaddedPODArray<Type> & indexes, size_t limit, Container & res_data)
+{
+    using T = typename Container::value_type;
+
+    const T * data_pos = data.data();
+    size_t pos = 0;
+
+    if constexpr (sizeof(T) == 4)
+    {
+        for (; pos + 16 <= limit; pos += 16)
+        {
+            __m512i vidx;
+            if constexpr (sizeof(Type) == 2)
+                vidx = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(indexes.data() + pos)));
+            else
+                vidx = _mm512_loadu_si512(reinterpret_cast<const void *>(indexes.data() + pos));
+
+            __m512i out = _mm512_i32gather_epi32(vidx, data_pos, 4);
+            _mm512_storeu_si512(reinterpret_cast<void *>(res_data.data() + pos), out);
+        }
+    }
+    else
+    {
+        static_assert(sizeof(T) == 8);
+        for (; pos + 8 <= limit; pos += 8)
+        {
+            __m256i vidx;
+            if constexpr (sizeof(Type) == 2)
+                vidx = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indexes.data() + pos)));
+            else
+                vidx = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indexes.data() + pos));
+
+            __m512i out = _mm512_i32gather_epi64(vidx, data_pos, 8);
+            _mm512_storeu_si512(reinterpret_cast<void *>(res_data.data() + pos), out);
+        }
+    }
+
+    for (; pos < limit; ++pos)
+        res_data[pos] = data[indexes[pos]];
+}
+);
+
 DECLARE_AVX512VBMI_SPECIFIC_CODE(
 template <typename Container, typename Type>
 inline void vectorIndexImpl(const Container & data, const PaddedPODArray<Type> & indexes, size_t limit, Container & res_data)
@@ -435,6 +482,15 @@ ColumnPtr ColumnVector<T>::indexImpl(const PaddedPODArray<Type> & indexes, size_
             return res;
         }
     }
+    else if constexpr ((sizeof(T) == 4 || sizeof(T) == 8) && (sizeof(Type) == 2 || sizeof(Type) == 4))
+    {
+        /// For wider elements the dictionary doesn't fit into registers, use hardware gather.
+        if (isArchSupported(TargetArch::AVX512F))
+        {
+            TargetSpecific::AVX512F::vectorIndexGatherImpl<Container, Type>(data, indexes, limit, res_data);
+            return res;
+        }
+    }
 #endif
     TargetSpecific::Default::vectorIndexImpl<Container, Type>(data, indexes, limit, res_data);
 
@@ -2,6 +2,7 @@
 #include <Columns/ColumnVector.h>
 #include <Common/typeid_cast.h>
 #include <Common/HashTable/HashSet.h>
+#include <Common/TargetSpecific.h>
 #include <bit>
 #include "ColumnsCommon.h"
 
@@ -119,8 +120,45 @@ namespace ErrorCodes
 }
 
 
+DECLARE_DEFAULT_CODE(
+inline void rebaseOffsets(IColumn::Offset * offsets, size_t size, IColumn::Offset diff)
+{
+    for (size_t i = 0; i < size; ++i)
+        offsets[i] -= diff;
+}
+)
+
+DECLARE_AVX512F_SPECIFIC_CODE(
+inline void rebaseOffsets(IColumn::Offset * offsets, size_t size, IColumn::Offset diff)
+{
+    const __m512i vdiff = _mm512_set1_epi64(diff);
+
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm512_storeu_si512(
+            reinterpret_cast<void *>(offsets + i),
+            _mm512_sub_epi64(_mm512_loadu_si512(reinterpret_cast<const void *>(offsets + i)), vdiff));
+
+    for (; i < size; ++i)
+        offsets[i] -= diff;
+}
+)
+
 namespace
 {
+    /// Rebase a freshly copied chunk of offsets so that the result offsets stay contiguous.
+    void rebaseOffsets(IColumn::Offset * offsets, size_t size, IColumn::Offset diff)
+    {
+#if USE_MULTITARGET_CODE
+        if (isArchSupported(TargetArch::AVX512F))
+        {
+            TargetSpecific::AVX512F::rebaseOffsets(offsets, size, diff);
+            return;
+        }
+#endif
+        TargetSpecific::Default::rebaseOffsets(offsets, size, diff);
+    }
+
     /// Implementation details of filterArraysImpl function, used as template parameter.
     /// Allow to build or not to build offsets array.
 
@@ -142,16 +180,16 @@ namespace
             res_offsets.push_back(current_src_offset);
         }
 
-        template <size_t SIMD_BYTES>
         void insertChunk(
             const IColumn::Offset * src_offsets_pos,
             bool first,
             IColumn::Offset chunk_offset,
-            size_t chunk_size)
+            size_t chunk_size,
+            size_t chunk_length)
         {
             const auto offsets_size_old = res_offsets.size();
-            res_offsets.resize(offsets_size_old + SIMD_BYTES);
-            memcpy(&res_offsets[offsets_size_old], src_offsets_pos, SIMD_BYTES * sizeof(IColumn::Offset));
+            res_offsets.resize(offsets_size_old + chunk_length);
+            memcpy(&res_offsets[offsets_size_old], src_offsets_pos, chunk_length * sizeof(IColumn::Offset));
 
             if (!first)
             {
@@ -159,13 +197,7 @@ namespace
                 const auto diff_offset = chunk_offset - current_src_offset;
 
                 if (diff_offset > 0)
-                {
-                    auto * res_offsets_pos = &res_offsets[offsets_size_old];
-
-                    /// adjust offsets
-                    for (size_t i = 0; i < SIMD_BYTES; ++i)
-                        res_offsets_pos[i] -= diff_offset;
-                }
+                    rebaseOffsets(&res_offsets[offsets_size_old], chunk_length, diff_offset);
             }
             current_src_offset += chunk_size;
         }
@@ -177,11 +209,11 @@ namespace
         void reserve(ssize_t, size_t) {}
         void insertOne(size_t) {}
 
-        template <size_t SIMD_BYTES>
         void insertChunk(
             const IColumn::Offset *,
             bool,
             IColumn::Offset,
+            size_t,
             size_t)
         {
         }
@@ -249,7 +281,7 @@ namespace
                 const auto chunk_offset = first ? 0 : offsets_pos[-1];
                 const auto chunk_size = offsets_pos[SIMD_BYTES - 1] - chunk_offset;
 
-                result_offsets_builder.template insertChunk<SIMD_BYTES>(offsets_pos, first, chunk_offset, chunk_size);
+                result_offsets_builder.insertChunk(offsets_pos, first, chunk_offset, chunk_size, SIMD_BYTES);
 
                 /// copy elements for SIMD_BYTES arrays at once
                 const auto elems_size_old = res_elems.size();
@@ -258,15 +290,29 @@ namespace
             }
             else
             {
+                /** Process runs of consecutive set bits at once: arrays that pass the filter together
+                  * occupy a contiguous range of elements, so a run needs a single memcpy
+                  * and a single (vectorizable) rebase of its offsets.
+                  */
                 while (mask)
                 {
-                    size_t index = std::countr_zero(mask);
-                    copy_array(offsets_pos + index);
-                #ifdef __BMI__
-                    mask = _blsr_u64(mask);
-                #else
-                    mask = mask & (mask-1);
-                #endif
+                    const size_t run_begin = std::countr_zero(mask);
+                    const size_t run_length = std::countr_one(mask >> run_begin);
+
+                    const auto * run_offsets_pos = offsets_pos + run_begin;
+                    const auto first = run_offsets_pos == offsets_begin;
+
+                    const auto run_offset = first ? 0 : run_offsets_pos[-1];
+                    const auto run_size = run_offsets_pos[run_length - 1] - run_offset;
+
+                    result_offsets_builder.insertChunk(run_offsets_pos, first, run_offset, run_size, run_length);
+
+                    const auto elems_size_old = res_elems.size();
+                    res_elems.resize(elems_size_old + run_size);
+                    memcpy(&res_elems[elems_size_old], &src_elems[run_offset], run_size * sizeof(T));
+
+                    /// The mask is not all-ones here, so run_begin + run_length < 64 or the run ends exactly at the top bit.
+                    mask &= ~(((UInt64(1) << run_length) - 1) << run_begin);
                 }
             }
 
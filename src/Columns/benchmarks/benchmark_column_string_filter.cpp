@@ -0,0 +1,80 @@
+#include <Columns/ColumnString.h>
+#include <Columns/ColumnsNumber.h>
+#include <base/types.h>
+#include <benchmark/benchmark.h>
+
+#include <pcg_random.hpp>
+
+using namespace DB;
+
+static constexpr size_t ROWS = 65536;
+
+/// ColumnString::filter is one of the hottest kernels under WHERE/PREWHERE -
+/// cover different string lengths and filter selectivities so both the
+/// memcpy-bound and the branch-bound regimes are tracked.
+
+static ColumnPtr mockStringColumn(size_t rows, size_t avg_length)
+{
+    auto column = ColumnString::create();
+    pcg64 rng(42);
+
+    String value;
+    for (size_t i = 0; i < rows; ++i)
+    {
+        value.resize(rng() % (2 * avg_length + 1));
+        for (auto & c : value)
+            c = 'a' + rng() % 26;
+        column->insertData(value.data(), value.size());
+    }
+
+    return column;
+}
+
+static void BM_ColumnStringFilter(benchmark::State & state)
+{
+    size_t avg_length = state.range(0);
+    size_t selectivity_percent = state.range(1);
+
+    auto column = mockStringColumn(ROWS, avg_length);
+
+    IColumn::Filter filter(ROWS);
+    pcg64 rng(42);
+    for (size_t i = 0; i < ROWS; ++i)
+        filter[i] = rng() % 100 < selectivity_percent;
+
+    for (auto _ : state)
+    {
+        auto res = column->filter(filter, -1);
+        benchmark::DoNotOptimize(res);
+    }
+
+    state.SetItemsProcessed(state.iterations() * ROWS);
+}
+
+BENCHMARK(BM_ColumnStringFilter)->ArgsProduct({{8, 64, 512}, {1, 10, 50, 90, 99}});
+
+static void BM_ColumnUInt64Filter(benchmark::State & state)
+{
+    size_t selectivity_percent = state.range(0);
+
+    auto column = ColumnUInt64::create();
+    auto & data = column->getData();
+    data.resize(ROWS);
+    pcg64 rng(42);
+    for (size_t i = 0; i < ROWS; ++i)
+        data[i] = rng();
+
+    IColumn::Filter filter(ROWS);
+    for (size_t i = 0; i < ROWS; ++i)
+        filter[i] = rng() % 100 < selectivity_percent;
+
+    for (auto _ : state)
+    {
+        auto res = column->filter(filter, -1);
+        benchmark::DoNotOptimize(res);
+    }
+
+    state.SetItemsProcessed(state.iterations() * ROWS);
+}
+
+BENCHMARK(BM_ColumnUInt64Filter)->Arg(1)->Arg(10)->Arg(50)->Arg(90)->Arg(99);
@@ -1,5 +1,6 @@
 #include <Common/Allocator.h>
 #include <Common/Exception.h>
+#include <Common/ProfileEvents.h>
 #include <Common/logger_useful.h>
 #include <Common/formatReadable.h>
 #include <Common/CurrentMemoryTracker.h>
@@ -10,6 +11,13 @@
 #include <Poco/Logger.h>
 #include <sys/mman.h> /// MADV_POPULATE_WRITE
 
+#include <atomic>
+
+
+namespace ProfileEvents
+{
+    extern const Event AllocatorHugePageBytes;
+}
 
 namespace DB
 {
@@ -27,7 +35,9 @@ namespace
 
 using namespace DB;
 
-#if defined(MADV_POPULATE_WRITE)
+std::atomic<bool> use_transparent_huge_pages{false};
+
+#if defined(MADV_POPULATE_WRITE) || defined(MADV_HUGEPAGE)
 /// Address passed to madvise is required to be aligned to the page boundary.
 auto adjustToPageSize(void * buf, size_t len, size_t page_size)
 {
@@ -37,6 +47,29 @@ auto adjustToPageSize(void * buf, size_t len, size_t page_size)
 }
 #endif
 
+/// Best-effort: the kernel is free to ignore the advice, and memory that is not backed
+/// by huge pages behaves exactly as before, so errors are only logged.
+void adviseHugePages([[maybe_unused]] void * buf_, [[maybe_unused]] size_t len_)
+{
+#if defined(MADV_HUGEPAGE)
+    if (len_ < HUGE_PAGE_ADVISE_THRESHOLD || !use_transparent_huge_pages.load(std::memory_order_relaxed))
+        return;
+
+    static const size_t page_size = ::getPageSize();
+    if (len_ < page_size) /// Rounded address should be still within [buf, buf + len).
+        return;
+
+    auto [buf, len] = adjustToPageSize(buf_, len_, page_size);
+    if (::madvise(buf, len, MADV_HUGEPAGE) < 0)
+        LOG_TRACE(
+            LogFrequencyLimiter(getLogger("Allocator"), 1),
+            "Attempt to advise huge pages failed: {} (it is expected if transparent huge pages are disabled system-wide)",
+            errnoToString(errno));
+    else
+        ProfileEvents::increment(ProfileEvents::AllocatorHugePageBytes, len);
+#endif
+}
+
 void prefaultPages([[maybe_unused]] void * buf_, [[maybe_unused]] size_t len_)
 {
 #if defined(MADV_POPULATE_WRITE)
@@ -83,6 +116,8 @@ void * allocNoTrack(size_t size, size_t alignment)
             memset(buf, 0, size);
     }
 
+    adviseHugePages(buf, size);
+
     if constexpr (populate)
         prefaultPages(buf, size);
 
@@ -107,6 +142,14 @@ void checkSize(size_t size)
 /// Constant is chosen almost arbitrarily, what I observed is 128KB is too small, 1MB is almost indistinguishable from 64MB and 1GB is too large.
 extern const size_t POPULATE_THRESHOLD = 16 * 1024 * 1024;
 
+/// Only allocations spanning many huge pages benefit; hash tables that suffer from TLB misses are much larger anyway.
+extern const size_t HUGE_PAGE_ADVISE_THRESHOLD = 16 * 1024 * 1024;
+
+void setUseTransparentHugePagesForLargeAllocations(bool value)
+{
+    use_transparent_huge_pages.store(value, std::memory_order_relaxed);
+}
+
 template <bool clear_memory_, bool populate>
 void * Allocator<clear_memory_, populate>::alloc(size_t size, size_t alignment)
 {
@@ -178,6 +221,8 @@ void * Allocator<clear_memory_, populate>::realloc(void * buf, size_t old_size,
         buf = new_buf;
     }
 
+    adviseHugePages(buf, new_size);
+
     if constexpr (populate)
         prefaultPages(buf, new_size);
 
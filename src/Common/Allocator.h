@@ -18,6 +18,14 @@
 
 
 extern const size_t POPULATE_THRESHOLD;
+extern const size_t HUGE_PAGE_ADVISE_THRESHOLD;
+
+/** Opt-in (server setting 'allocator_use_transparent_huge_pages'): advise the kernel to back
+  * allocations above HUGE_PAGE_ADVISE_THRESHOLD with transparent huge pages (MADV_HUGEPAGE).
+  * This is best-effort: it lowers TLB misses of huge hash tables (aggregation, joins)
+  * but may increase memory usage due to coarser page granularity.
+  */
+void setUseTransparentHugePagesForLargeAllocations(bool value);
 
 static constexpr size_t MALLOC_MIN_ALIGNMENT = 8;
 
@@ -6,6 +6,7 @@
 #include <Core/Defines.h>
 #include <boost/noncopyable.hpp>
 #include <Common/Allocator.h>
+#include <Common/BitHelpers.h>
 #include <Common/ProfileEvents.h>
 #include <Common/memcpySmall.h>
 #include <base/getPageSize.h>
@@ -38,6 +39,26 @@ class Arena : private boost::noncopyable
 private:
     static constexpr size_t pad_right = PADDING_FOR_SIMD - 1;
 
+    /// If a block is in a free list, the pointer to the next free block is stored at its beginning.
+    union FreeBlock
+    {
+        FreeBlock * next;
+        char data[0];
+    };
+
+    /// The maximum size class that is recycled via 'recycle' / 'alignedAllocWithReuse'.
+    static constexpr size_t max_recycled_block_size = 65536;
+
+    /// Get the index in the free list array for the specified size (same size classes as ArenaWithFreeLists).
+    static size_t freeListIndex(const size_t size)
+    {
+        return size <= 8 ? 2 : bitScanReverse(size - 1);
+    }
+
+    /// Lists of recycled blocks. Each element points to the head of the corresponding list, or is nullptr.
+    /// The first two elements are not used, but are intended to simplify arithmetic.
+    FreeBlock * free_lists[16] {};
+
     /// Contiguous MemoryChunk of memory and pointer to free space inside it. Member of single-linked list.
     struct alignas(16) MemoryChunk : private Allocator<false>    /// empty base optimization
     {
@@ -232,6 +253,56 @@ public:
         return head.pos;
     }
 
+    /** Get a piece of memory, preferring a piece previously returned via 'recycle'.
+      * The size is rounded up to a power of two (at least 8, at most 65536 bytes;
+      * larger sizes are served by plain alignedAlloc and cannot be recycled).
+      * All allocations of a given size class must use the same alignment.
+      *
+      * Used for aggregate function states: during destructive merges the Aggregator
+      * destroys states of the source table and their memory can be reused for states
+      * that are created later (see Aggregator::mergeDataImpl), lowering peak memory usage.
+      */
+    char * alignedAllocWithReuse(size_t size, size_t alignment)
+    {
+        if (unlikely(size > max_recycled_block_size))
+            return alignedAlloc(size, alignment);
+
+        const auto list_idx = freeListIndex(size);
+
+        if (auto & free_block_ptr = free_lists[list_idx])
+        {
+            ASAN_UNPOISON_MEMORY_REGION(free_block_ptr, std::max(size, sizeof(FreeBlock)));
+
+            auto * const res = free_block_ptr->data;
+            free_block_ptr = free_block_ptr->next;
+            return res;
+        }
+
+        /// Allocate the whole size class, so that any piece of the same class can be reused for it later.
+        return alignedAlloc(1ULL << (list_idx + 1), alignment);
+    }
+
+    /** Return a piece of memory obtained from 'alignedAllocWithReuse' for later reuse.
+      * The piece may have been allocated by a different Arena: the memory is only linked,
+      * not owned, so the caller must guarantee that the originating arena lives as long
+      * as this one (the Aggregator merges pools of merged variants into the result).
+      */
+    void recycle(char * ptr, size_t size)
+    {
+        if (unlikely(size > max_recycled_block_size))
+            return;
+
+        const auto list_idx = freeListIndex(size);
+
+        auto & free_block_ptr = free_lists[list_idx];
+        auto * const old_head = free_block_ptr;
+        free_block_ptr = reinterpret_cast<FreeBlock *>(ptr);
+        free_block_ptr->next = old_head;
+
+        /// Poison the whole block; it is unpoisoned again when taken from the free list.
+        ASAN_POISON_MEMORY_REGION(ptr, 1ULL << (list_idx + 1));
+    }
+
     /** Begin or expand a contiguous range of memory.
       * 'range_start' is the start of range. If nullptr, a new range is
       * allocated.
@@ -13,6 +13,7 @@
 #include <mutex>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 
 namespace DB
@@ -28,6 +29,12 @@ namespace ErrorCodes
 /// of that value.
 /// Cache starts to evict entries when their total weight exceeds max_size_in_bytes.
 /// Value weight should not change after insertion.
+///
+/// To reduce lock contention on many-core machines the cache can be split into several
+/// shards, each with its own mutex and cache policy instance. Keys are distributed among
+/// shards by hash, sizes and counts are divided evenly. Sharding is only supported for the
+/// general-purpose LRU/SLRU policies: eviction then happens per shard, which is a good
+/// approximation for caches with many entries of similar weight (marks, uncompressed blocks).
 template <typename TKey, typename TMapped, typename HashFunction = std::hash<TKey>, typename WeightFunction = EqualWeightFunction<TMapped>>
 class CacheBase
 {
@@ -50,8 +57,11 @@ public:
     }
 
     /// Use this ctor if the user should be able to configure the cache policy and cache sizes via settings. Supports only general-purpose policies LRU and SLRU.
-    explicit CacheBase(std::string_view cache_policy_name, size_t max_size_in_bytes, size_t max_count, double size_ratio)
+    explicit CacheBase(std::string_view cache_policy_name, size_t max_size_in_bytes, size_t max_count, double size_ratio, size_t num_shards = 1)
     {
+        if (num_shards == 0)
+            throw Exception(ErrorCodes::BAD_ARGUMENTS, "Number of cache shards must be positive");
+
         auto on_weight_loss_function = [&](size_t weight_loss) { onRemoveOverflowWeightLoss(weight_loss); };
 
         if (cache_policy_name.empty())
@@ -60,29 +70,39 @@ public:
             cache_policy_name = default_cache_policy;
         }
 
-        if (cache_policy_name == "LRU")
-        {
-            using LRUPolicy = LRUCachePolicy<TKey, TMapped, HashFunction, WeightFunction>;
-            cache_policy = std::make_unique<LRUPolicy>(max_size_in_bytes, max_count, on_weight_loss_function);
-        }
-        else if (cache_policy_name == "SLRU")
+        shards.reserve(num_shards);
+        for (size_t i = 0; i < num_shards; ++i)
         {
-            using SLRUPolicy = SLRUCachePolicy<TKey, TMapped, HashFunction, WeightFunction>;
-            cache_policy = std::make_unique<SLRUPolicy>(max_size_in_bytes, max_count, size_ratio, on_weight_loss_function);
+            std::unique_ptr<CachePolicy> policy;
+
+            if (cache_policy_name == "LRU")
+            {
+                using LRUPolicy = LRUCachePolicy<TKey, TMapped, HashFunction, WeightFunction>;
+                policy = std::make_unique<LRUPolicy>(max_size_in_bytes / num_shards, max_count / num_shards, on_weight_loss_function);
+            }
+            else if (cache_policy_name == "SLRU")
+            {
+                using SLRUPolicy = SLRUCachePolicy<TKey, TMapped, HashFunction, WeightFunction>;
+                policy = std::make_unique<SLRUPolicy>(max_size_in_bytes / num_shards, max_count / num_shards, size_ratio, on_weight_loss_function);
+            }
+            else
+                throw Exception(ErrorCodes::BAD_ARGUMENTS, "Unknown cache policy name: {}", cache_policy_name);
+
+            shards.push_back(std::make_unique<Shard>(std::move(policy)));
         }
-        else
-            throw Exception(ErrorCodes::BAD_ARGUMENTS, "Unknown cache policy name: {}", cache_policy_name);
     }
 
     /// Use this ctor to provide an arbitrary cache policy.
     explicit CacheBase(std::unique_ptr<ICachePolicy<TKey, TMapped, HashFunction, WeightFunction>> cache_policy_)
-        : cache_policy(std::move(cache_policy_))
-    {}
+    {
+        shards.push_back(std::make_unique<Shard>(std::move(cache_policy_)));
+    }
 
     MappedPtr get(const Key & key)
     {
-        std::lock_guard lock(mutex);
-        auto res = cache_policy->get(key);
+        auto & shard = shardForKey(key);
+        std::lock_guard lock(shard.mutex);
+        auto res = shard.policy->get(key);
         if (res)
             ++hits;
         else
@@ -92,8 +112,9 @@ public:
 
     std::optional<KeyMapped> getWithKey(const Key & key)
     {
-        std::lock_guard lock(mutex);
-        auto res = cache_policy->getWithKey(key);
+        auto & shard = shardForKey(key);
+        std::lock_guard lock(shard.mutex);
+        auto res = shard.policy->getWithKey(key);
         if (res.has_value())
             ++hits;
         else
@@ -103,8 +124,9 @@ public:
 
     void set(const Key & key, const MappedPtr & mapped)
     {
-        std::lock_guard lock(mutex);
-        cache_policy->set(key, mapped);
+        auto & shard = shardForKey(key);
+        std::lock_guard lock(shard.mutex);
+        shard.policy->set(key, mapped);
     }
 
     /// If the value for the key is in the cache, returns it. If it is not, calls load_func() to
@@ -118,19 +140,21 @@ public:
     template <typename LoadFunc>
     std::pair<MappedPtr, bool> getOrSet(const Key & key, LoadFunc && load_func)
     {
+        auto & shard = shardForKey(key);
+
         InsertTokenHolder token_holder;
         {
-            std::lock_guard cache_lock(mutex);
-            auto val = cache_policy->get(key);
+            std::lock_guard cache_lock(shard.mutex);
+            auto val = shard.policy->get(key);
             if (val)
             {
                 ++hits;
                 return std::make_pair(val, false);
             }
 
-            auto & token = insert_tokens[key];
+            auto & token = shard.insert_tokens[key];
             if (!token)
-                token = std::make_shared<InsertToken>(*this);
+                token = std::make_shared<InsertToken>(shard);
 
             token_holder.acquire(&key, token, cache_lock);
         }
@@ -145,21 +169,22 @@ public:
         {
             /// Another thread already produced the value while we waited for token->mutex.
             ++hits;
+            onSharedLoad();
             return std::make_pair(token->value, false);
         }
 
         ++misses;
         token->value = load_func();
 
-        std::lock_guard cache_lock(mutex);
+        std::lock_guard cache_lock(shard.mutex);
 
         /// Insert the new value only if the token is still in present in insert_tokens.
         /// (The token may be absent because of a concurrent clear() call).
         bool result = false;
-        auto token_it = insert_tokens.find(key);
-        if (token_it != insert_tokens.end() && token_it->second.get() == token)
+        auto token_it = shard.insert_tokens.find(key);
+        if (token_it != shard.insert_tokens.end() && token_it->second.get() == token)
         {
-            cache_policy->set(key, token->value);
+            shard.policy->set(key, token->value);
             result = true;
         }
 
@@ -171,94 +196,131 @@ public:
 
     void getStats(size_t & out_hits, size_t & out_misses) const
     {
-        std::lock_guard lock(mutex);
         out_hits = hits;
         out_misses = misses;
     }
 
     std::vector<KeyMapped> dump() const
     {
-        std::lock_guard lock(mutex);
-        return cache_policy->dump();
+        std::vector<KeyMapped> res;
+        for (const auto & shard : shards)
+        {
+            std::lock_guard lock(shard->mutex);
+            auto shard_dump = shard->policy->dump();
+            res.insert(res.end(), std::make_move_iterator(shard_dump.begin()), std::make_move_iterator(shard_dump.end()));
+        }
+        return res;
     }
 
     void clear()
     {
-        std::lock_guard lock(mutex);
-        insert_tokens.clear();
+        for (auto & shard : shards)
+        {
+            std::lock_guard lock(shard->mutex);
+            shard->insert_tokens.clear();
+            shard->policy->clear();
+        }
         hits = 0;
         misses = 0;
-        cache_policy->clear();
     }
 
     void remove(const Key & key)
     {
-        std::lock_guard lock(mutex);
-        cache_policy->remove(key);
+        auto & shard = shardForKey(key);
+        std::lock_guard lock(shard.mutex);
+        shard.policy->remove(key);
     }
 
     size_t sizeInBytes() const
     {
-        std::lock_guard lock(mutex);
-        return cache_policy->sizeInBytes();
+        size_t res = 0;
+        for (const auto & shard : shards)
+        {
+            std::lock_guard lock(shard->mutex);
+            res += shard->policy->sizeInBytes();
+        }
+        return res;
     }
 
     size_t count() const
     {
-        std::lock_guard lock(mutex);
-        return cache_policy->count();
+        size_t res = 0;
+        for (const auto & shard : shards)
+        {
+            std::lock_guard lock(shard->mutex);
+            res += shard->policy->count();
+        }
+        return res;
     }
 
     size_t maxSizeInBytes() const
     {
-        std::lock_guard lock(mutex);
-        return cache_policy->maxSizeInBytes();
+        size_t res = 0;
+        for (const auto & shard : shards)
+        {
+            std::lock_guard lock(shard->mutex);
+            res += shard->policy->maxSizeInBytes();
+        }
+        return res;
     }
 
     void setMaxCount(size_t max_count)
     {
-        std::lock_guard lock(mutex);
-        cache_policy->setMaxCount(max_count);
+        for (auto & shard : shards)
+        {
+            std::lock_guard lock(shard->mutex);
+            shard->policy->setMaxCount(max_count / shards.size());
+        }
     }
 
     void setMaxSizeInBytes(size_t max_size_in_bytes)
     {
-        std::lock_guard lock(mutex);
-        cache_policy->setMaxSizeInBytes(max_size_in_bytes);
+        for (auto & shard : shards)
+        {
+            std::lock_guard lock(shard->mutex);
+            shard->policy->setMaxSizeInBytes(max_size_in_bytes / shards.size());
+        }
     }
 
     void setQuotaForUser(const UUID & user_id, size_t max_size_in_bytes, size_t max_entries)
     {
-        std::lock_guard lock(mutex);
-        cache_policy->setQuotaForUser(user_id, max_size_in_bytes, max_entries);
+        for (auto & shard : shards)
+        {
+            std::lock_guard lock(shard->mutex);
+            shard->policy->setQuotaForUser(user_id, max_size_in_bytes / shards.size(), max_entries / shards.size());
+        }
     }
 
     virtual ~CacheBase() = default;
 
-protected:
-    mutable std::mutex mutex;
-
 private:
-    std::unique_ptr<CachePolicy> cache_policy TSA_GUARDED_BY(mutex);
-
-    std::atomic<size_t> hits{0};
-    std::atomic<size_t> misses{0};
+    /// Represents pending insertion attempt on a shard.
+    struct Shard;
 
-    /// Represents pending insertion attempt.
     struct InsertToken
     {
-        explicit InsertToken(CacheBase & cache_) : cache(cache_) {}
+        explicit InsertToken(Shard & shard_) : shard(shard_) {}
 
         std::mutex mutex;
         bool cleaned_up TSA_GUARDED_BY(mutex) = false;
         MappedPtr value TSA_GUARDED_BY(mutex);
 
-        CacheBase & cache;
-        size_t refcount = 0; /// Protected by the cache mutex
+        Shard & shard;
+        size_t refcount = 0; /// Protected by the shard mutex
     };
 
     using InsertTokenById = std::unordered_map<Key, std::shared_ptr<InsertToken>, HashFunction>;
 
+    /// A slice of the cache with its own lock and eviction state.
+    struct Shard
+    {
+        explicit Shard(std::unique_ptr<CachePolicy> policy_) : policy(std::move(policy_)) {}
+
+        mutable std::mutex mutex;
+        std::unique_ptr<CachePolicy> policy TSA_GUARDED_BY(mutex);
+        InsertTokenById insert_tokens TSA_GUARDED_BY(mutex);
+    };
+
     /// This class is responsible for removing used insert tokens from the insert_tokens map.
     /// Among several concurrent threads the first successful one is responsible for removal. But if they all
     /// fail, then the last one is responsible.
@@ -271,7 +333,7 @@ private:
         InsertTokenHolder() = default;
 
         void acquire(const Key * key_, const std::shared_ptr<InsertToken> & token_, std::lock_guard<std::mutex> & /* cache_lock */)
-            TSA_NO_THREAD_SAFETY_ANALYSIS // disabled only because we can't reference the parent-level cache mutex from here
+            TSA_NO_THREAD_SAFETY_ANALYSIS // disabled only because we can't reference the shard-level cache mutex from here
         {
             key = key_;
             token = token_;
@@ -279,9 +341,9 @@ private:
         }
 
         void cleanup(std::lock_guard<std::mutex> & /* token_lock */, std::lock_guard<std::mutex> & /* cache_lock */)
-            TSA_NO_THREAD_SAFETY_ANALYSIS // disabled only because we can't reference the parent-level cache mutex from here
+            TSA_NO_THREAD_SAFETY_ANALYSIS // disabled only because we can't reference the shard-level cache mutex from here
         {
-            token->cache.insert_tokens.erase(*key);
+            token->shard.insert_tokens.erase(*key);
             token->cleaned_up = true;
             cleaned_up = true;
         }
@@ -299,7 +361,7 @@ private:
             if (token->cleaned_up)
                 return;
 
-            std::lock_guard cache_lock(token->cache.mutex);
+            std::lock_guard cache_lock(token->shard.mutex);
 
             --token->refcount;
             if (token->refcount == 0)
@@ -309,10 +371,24 @@ private:
 
     friend struct InsertTokenHolder;
 
-    InsertTokenById insert_tokens TSA_GUARDED_BY(mutex);
+    std::vector<std::unique_ptr<Shard>> shards;
+
+    std::atomic<size_t> hits{0};
+    std::atomic<size_t> misses{0};
+
+    Shard & shardForKey(const Key & key)
+    {
+        if (shards.size() == 1)
+            return *shards.front();
+        return *shards[HashFunction()(key) % shards.size()];
+    }
 
     /// Override this method if you want to track how much weight was lost in removeOverflow method.
     virtual void onRemoveOverflowWeightLoss(size_t /*weight_loss*/) {}
+
+    /// Override this method if you want to track how many times a getOrSet() call reused the value
+    /// which was being produced by a concurrent caller instead of calling load_func() itself.
+    virtual void onSharedLoad() {}
 };
 
 
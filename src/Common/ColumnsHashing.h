@@ -229,18 +229,33 @@ private:
 };
 
 
+enum class VisitValue
+{
+    Empty = 0,
+    Found = 1,
+    NotFound = 2,
+};
+
+/// Per-dictionary lookup results which may be reused between blocks sharing the same dictionary.
+/// Owned by the caller (typically the aggregation method), so the cached mapped values
+/// never outlive the hash table they point into.
+template <typename Mapped>
+struct LowCardinalitySharedDictionaryLookups
+{
+    UInt128 dictionary_hash{};
+    UInt64 dictionary_size = 0;
+
+    PaddedPODArray<VisitValue> visit_cache;
+    columns_hashing_impl::MappedCache<Mapped> mapped_cache;
+};
+
+
 /// Single low cardinality column.
 template <typename SingleColumnMethod, typename Mapped, bool use_cache>
 struct HashMethodSingleLowCardinalityColumn : public SingleColumnMethod
 {
     using Base = SingleColumnMethod;
-
-    enum class VisitValue
-    {
-        Empty = 0,
-        Found = 1,
-        NotFound = 2,
-    };
+    using SharedDictionaryLookups = LowCardinalitySharedDictionaryLookups<Mapped>;
 
     static constexpr bool has_mapped = !std::is_same_v<Mapped, void>;
     using EmplaceResult = columns_hashing_impl::EmplaceResultImpl<Mapped>;
@@ -263,8 +278,16 @@ struct HashMethodSingleLowCardinalityColumn : public SingleColumnMethod
     ColumnPtr dictionary_holder;
 
     /// Cache AggregateDataPtr for current column in order to decrease the number of hash table usages.
-    columns_hashing_impl::MappedCache<Mapped> mapped_cache;
-    PaddedPODArray<VisitValue> visit_cache;
+    columns_hashing_impl::MappedCache<Mapped> own_mapped_cache;
+    PaddedPODArray<VisitValue> own_visit_cache;
+
+    /// Point either to the per-block caches above or to lookups shared between blocks
+    /// with the same dictionary (see attachSharedDictionaryLookups).
+    columns_hashing_impl::MappedCache<Mapped> * mapped_cache = &own_mapped_cache;
+    PaddedPODArray<VisitValue> * visit_cache = &own_visit_cache;
+
+    LowCardinalityDictionaryCache::DictionaryKey dictionary_key{};
+    bool is_shared_dictionary = false;
 
     /// If initialized column is nullable.
     bool is_nullable = false;
@@ -302,12 +325,11 @@ struct HashMethodSingleLowCardinalityColumn : public SingleColumnMethod
         const auto * dict = column->getDictionary().getNestedNotNullableColumn().get();
         is_nullable = column->getDictionary().nestedColumnIsNullable();
         key_columns = {dict};
-        bool is_shared_dict = column->isSharedDictionary();
+        is_shared_dictionary = column->isSharedDictionary();
 
-        typename LowCardinalityDictionaryCache::DictionaryKey dictionary_key;
         typename LowCardinalityDictionaryCache::CachedValuesPtr cached_values;
 
-        if (is_shared_dict)
+        if (is_shared_dictionary)
         {
             dictionary_key = {column->getDictionary().getHash(), dict->size()};
             if constexpr (use_cache)
@@ -326,7 +348,7 @@ struct HashMethodSingleLowCardinalityColumn : public SingleColumnMethod
 
             if constexpr (use_cache)
             {
-                if (is_shared_dict)
+                if (is_shared_dictionary)
                 {
                     cached_values = std::make_shared<typename LowCardinalityDictionaryCache::CachedValues>();
                     cached_values->saved_hash = saved_hash;
@@ -338,15 +360,40 @@ struct HashMethodSingleLowCardinalityColumn : public SingleColumnMethod
         }
 
         if constexpr (has_mapped)
-            mapped_cache.resize(key_columns[0]->size());
+            own_mapped_cache.resize(key_columns[0]->size());
 
         VisitValue empty(VisitValue::Empty);
-        visit_cache.assign(key_columns[0]->size(), empty);
+        own_visit_cache.assign(key_columns[0]->size(), empty);
 
         size_of_index_type = column->getSizeOfIndexType();
         positions = column->getIndexesPtr().get();
     }
 
+    /// Reuse lookup results between blocks whose columns share the dictionary: already visited
+    /// dictionary entries resolve to their mapped values without touching the hash table at all.
+    /// May only be called while the hash table (and the states the cached values refer to) is alive;
+    /// does nothing if the column does not report a shared dictionary.
+    void attachSharedDictionaryLookups(SharedDictionaryLookups & lookups)
+    {
+        if (!is_shared_dictionary)
+            return;
+
+        if (lookups.dictionary_hash != dictionary_key.hash || lookups.dictionary_size != dictionary_key.size)
+        {
+            lookups.dictionary_hash = dictionary_key.hash;
+            lookups.dictionary_size = dictionary_key.size;
+
+            if constexpr (has_mapped)
+                lookups.mapped_cache.resize(key_columns[0]->size());
+
+            lookups.visit_cache.assign(key_columns[0]->size(), VisitValue::Empty);
+        }
+
+        if constexpr (has_mapped)
+            mapped_cache = &lookups.mapped_cache;
+        visit_cache = &lookups.visit_cache;
+    }
+
     ALWAYS_INLINE size_t getIndexAt(size_t row) const
     {
         switch (size_of_index_type)
@@ -372,20 +419,20 @@ struct HashMethodSingleLowCardinalityColumn : public SingleColumnMethod
 
         if (is_nullable && row == 0)
         {
-            visit_cache[row] = VisitValue::Found;
+            (*visit_cache)[row] = VisitValue::Found;
             bool has_null_key = data.hasNullKeyData();
             data.hasNullKeyData() = true;
 
             if constexpr (has_mapped)
-                return EmplaceResult(data.getNullKeyData(), mapped_cache[0], !has_null_key);
+                return EmplaceResult(data.getNullKeyData(), (*mapped_cache)[0], !has_null_key);
             else
                 return EmplaceResult(!has_null_key);
         }
 
-        if (visit_cache[row] == VisitValue::Found)
+        if ((*visit_cache)[row] == VisitValue::Found)
         {
             if constexpr (has_mapped)
-                return EmplaceResult(mapped_cache[row], mapped_cache[row], false);
+                return EmplaceResult((*mapped_cache)[row], (*mapped_cache)[row], false);
             else
                 return EmplaceResult(false);
         }
@@ -399,7 +446,7 @@ struct HashMethodSingleLowCardinalityColumn : public SingleColumnMethod
         else
             data.emplace(key_holder, it, inserted);
 
-        visit_cache[row] = VisitValue::Found;
+        (*visit_cache)[row] = VisitValue::Found;
 
         if constexpr (has_mapped)
         {
@@ -408,8 +455,8 @@ struct HashMethodSingleLowCardinalityColumn : public SingleColumnMethod
             {
                 new (&mapped) Mapped();
             }
-            mapped_cache[row] = mapped;
-            return EmplaceResult(mapped, mapped_cache[row], inserted);
+            (*mapped_cache)[row] = mapped;
+            return EmplaceResult(mapped, (*mapped_cache)[row], inserted);
         }
         else
             return EmplaceResult(inserted);
@@ -436,12 +483,12 @@ struct HashMethodSingleLowCardinalityColumn : public SingleColumnMethod
                 return FindResult(data.hasNullKeyData(), 0);
         }
 
-        if (visit_cache[row] != VisitValue::Empty)
+        if ((*visit_cache)[row] != VisitValue::Empty)
         {
             if constexpr (has_mapped)
-                return FindResult(&mapped_cache[row], visit_cache[row] == VisitValue::Found, 0);
+                return FindResult(&(*mapped_cache)[row], (*visit_cache)[row] == VisitValue::Found, 0);
             else
-                return FindResult(visit_cache[row] == VisitValue::Found, 0);
+                return FindResult((*visit_cache)[row] == VisitValue::Found, 0);
         }
 
         auto key_holder = getKeyHolder(row_, pool);
@@ -453,12 +500,12 @@ struct HashMethodSingleLowCardinalityColumn : public SingleColumnMethod
             it = data.find(keyHolderGetKey(key_holder));
 
         bool found = it;
-        visit_cache[row] = found ? VisitValue::Found : VisitValue::NotFound;
+        (*visit_cache)[row] = found ? VisitValue::Found : VisitValue::NotFound;
 
         if constexpr (has_mapped)
         {
             if (found)
-                mapped_cache[row] = it->getMapped();
+                (*mapped_cache)[row] = it->getMapped();
         }
 
         size_t offset = 0;
@@ -467,7 +514,7 @@ struct HashMethodSingleLowCardinalityColumn : public SingleColumnMethod
             offset = found ? data.offsetInternal(it) : 0;
 
         if constexpr (has_mapped)
-            return FindResult(&mapped_cache[row], found, offset);
+            return FindResult(&(*mapped_cache)[row], found, offset);
         else
             return FindResult(found, offset);
     }
@@ -529,6 +576,7 @@ struct HashMethodKeysFixed
 #endif
 
     PaddedPODArray<Key> prepared_keys;
+    PaddedPODArray<size_t> prepared_hashes;
 
     static bool usePreparedKeys(const Sizes & key_sizes)
     {
@@ -648,6 +696,24 @@ struct HashMethodKeysFixed
         }
     }
 
+    bool hasPreparedKeys() const { return !prepared_keys.empty(); }
+
+    /// If the keys were packed in advance by packFixedBatch(), also hash them in advance, in one tight loop over
+    /// the contiguous array of packed keys. Unlike hashing inside the probe loop, where each hash calculation is
+    /// interleaved with a hash table lookup, this loop has no data-dependent branches and pipelines well.
+    /// The caller is expected to pass the returned hashes back to emplaceKey()/findKey() and to prefetchByHash().
+    template <typename Data>
+    const PaddedPODArray<size_t> & getPreparedHashes(const Data & data, size_t row_begin, size_t row_end)
+    {
+        if (prepared_hashes.size() < row_end)
+            prepared_hashes.resize(row_end);
+
+        for (size_t i = row_begin; i < row_end; ++i)
+            prepared_hashes[i] = data.hash(prepared_keys[i]);
+
+        return prepared_hashes;
+    }
+
     static std::optional<Sizes> shuffleKeyColumns(std::vector<IColumn *> & key_columns, const Sizes & key_sizes)
     {
         if (!usePreparedKeys(key_sizes))
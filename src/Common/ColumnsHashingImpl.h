@@ -182,8 +182,10 @@ public:
 
     static HashMethodContextPtr createContext(const HashMethodContext::Settings &) { return nullptr; }
 
-    template <typename Data>
-    ALWAYS_INLINE EmplaceResult emplaceKey(Data & data, size_t row, Arena & pool)
+    /// Emplace the key at the given row into the hash table.
+    /// Optionally takes a precalculated value of the hash function for this key (see e.g. getPreparedHashes() in HashMethodKeysFixed).
+    template <typename Data, typename... Hash>
+    ALWAYS_INLINE EmplaceResult emplaceKey(Data & data, size_t row, Arena & pool, Hash... hash)
     {
         if constexpr (nullable)
         {
@@ -209,11 +211,12 @@ public:
         }
 
         auto key_holder = static_cast<Derived &>(*this).getKeyHolder(row, pool);
-        return emplaceImpl(key_holder, data);
+        return emplaceImpl(key_holder, data, hash...);
     }
 
-    template <typename Data>
-    ALWAYS_INLINE FindResult findKey(Data & data, size_t row, Arena & pool)
+    /// Find the key at the given row in the hash table, optionally with a precalculated value of the hash function.
+    template <typename Data, typename... Hash>
+    ALWAYS_INLINE FindResult findKey(Data & data, size_t row, Arena & pool, Hash... hash)
     {
         if constexpr (nullable)
         {
@@ -238,7 +241,7 @@ public:
         }
 
         auto key_holder = static_cast<Derived &>(*this).getKeyHolder(row, pool);
-        return findKeyImpl(keyHolderGetKey(key_holder), data);
+        return findKeyImpl(keyHolderGetKey(key_holder), data, hash...);
     }
 
     template <typename Data>
@@ -308,8 +311,8 @@ protected:
             null_map = &checkAndGetColumn<ColumnNullable>(column)->getNullMapColumn();
     }
 
-    template <typename Data, typename KeyHolder>
-    ALWAYS_INLINE EmplaceResult emplaceImpl(KeyHolder & key_holder, Data & data)
+    template <typename Data, typename KeyHolder, typename... Hash>
+    ALWAYS_INLINE EmplaceResult emplaceImpl(KeyHolder & key_holder, Data & data, Hash... hash)
     {
         if constexpr (consecutive_keys_optimization)
         {
@@ -324,7 +327,7 @@ protected:
 
         typename Data::LookupResult it;
         bool inserted = false;
-        data.emplace(key_holder, it, inserted);
+        data.emplace(key_holder, it, inserted, hash...);
 
         [[maybe_unused]] Mapped * cached = nullptr;
         if constexpr (has_mapped)
@@ -363,8 +366,8 @@ protected:
             return EmplaceResult(inserted);
     }
 
-    template <typename Data, typename Key>
-    ALWAYS_INLINE FindResult findKeyImpl(Key key, Data & data)
+    template <typename Data, typename Key, typename... Hash>
+    ALWAYS_INLINE FindResult findKeyImpl(Key key, Data & data, Hash... hash)
     {
         if constexpr (consecutive_keys_optimization)
         {
@@ -380,7 +383,7 @@ protected:
             }
         }
 
-        auto it = data.find(key);
+        auto it = data.find(key, hash...);
 
         if constexpr (consecutive_keys_optimization)
         {
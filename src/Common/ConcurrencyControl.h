@@ -34,6 +34,15 @@ namespace DB
  * Released slots are distributed between waiting allocations in a round-robin manner to provide fairness.
  * Oversubscription is possible: total amount of allocated slots can exceed `setMaxConcurrency(limit)`
  * because `min` amount of slots is allocated for each query unconditionally.
+ *
+ * This is the CPU counterpart of the I/O scheduler, and the place weighted workload classes
+ * would plug in: slot handout is the admission point for executor threads, so replacing the
+ * round-robin over waiters with a weighted pick per workload gives proportional CPU shares
+ * without preempting running tasks. Finer-grained enforcement (yielding mid-query based on
+ * consumed CPU slices) is intentionally not done in the executor: a thread holding a slot
+ * runs until its pipeline has no tasks, and shares are realized by granting upscaling slots
+ * to starved classes first. Until then the knobs are `concurrent_threads_soft_limit_*` plus
+ * per-query `max_threads` / `os_thread_priority`.
  */
 class ConcurrencyControl : public ISlotControl
 {
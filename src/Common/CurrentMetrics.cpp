@@ -192,6 +192,9 @@
     M(RestartReplicaThreads, "Number of threads in the RESTART REPLICA thread pool.") \
     M(RestartReplicaThreadsActive, "Number of threads in the RESTART REPLICA thread pool running a task.") \
     M(RestartReplicaThreadsScheduled, "Number of queued or active jobs in the RESTART REPLICA thread pool.") \
+    M(ConcurrentHashJoinPoolThreads, "Number of threads in the thread pool for parallel hash join initialization.") \
+    M(ConcurrentHashJoinPoolThreadsActive, "Number of threads in the thread pool for parallel hash join initialization running a task.") \
+    M(ConcurrentHashJoinPoolThreadsScheduled, "Number of queued or active jobs in the thread pool for parallel hash join initialization.") \
     M(QueryPipelineExecutorThreads, "Number of threads in the PipelineExecutor thread pool.") \
     M(QueryPipelineExecutorThreadsActive, "Number of threads in the PipelineExecutor thread pool running a task.") \
     M(QueryPipelineExecutorThreadsScheduled, "Number of queued or active jobs in the PipelineExecutor thread pool.") \
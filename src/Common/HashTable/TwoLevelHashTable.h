@@ -119,6 +119,33 @@ public:
         }
     }
 
+    /// Same as the converting constructor, but fills only the subrange of buckets [begin_bucket, end_bucket).
+    /// Allows to parallelize the conversion: each thread scans the whole source but writes only to its own
+    /// disjoint bucket range, so no synchronization on the destination is needed.
+    template <typename Source>
+    void insertFromTable(const Source & src, size_t begin_bucket, size_t end_bucket)
+    {
+        typename Source::const_iterator it = src.begin();
+
+        /// It is assumed that the zero key (stored separately) is first in iteration order.
+        if (it != src.end() && it.getPtr()->isZero(src))
+        {
+            size_t buck = getBucketFromHash(hash(Cell::getKey(it->getValue())));
+            if (buck >= begin_bucket && buck < end_bucket)
+                insert(it->getValue());
+            ++it;
+        }
+
+        for (; it != src.end(); ++it)
+        {
+            const Cell * cell = it.getPtr();
+            size_t hash_value = cell->getHash(src);
+            size_t buck = getBucketFromHash(hash_value);
+            if (buck >= begin_bucket && buck < end_bucket)
+                impls[buck].insertUniqueNonZero(cell, hash_value);
+        }
+    }
+
 
     class iterator /// NOLINT
     {
@@ -238,6 +265,12 @@ public:
         impls[bucket].prefetchByHash(key_hash);
     }
 
+    void ALWAYS_INLINE prefetchByHash(size_t hash_value) const
+    {
+        const auto bucket = getBucketFromHash(hash_value);
+        impls[bucket].prefetchByHash(hash_value);
+    }
+
     /** Insert the key,
       * return an iterator to a position that can be used for `placement new` of value,
       * as well as the flag - whether a new key was inserted.
@@ -72,6 +72,33 @@ public:
         }
     }
 
+    /// Same as the converting constructor, but fills only the subrange of buckets [begin_bucket, end_bucket).
+    /// Allows to parallelize the conversion: each thread scans the whole source but writes only to its own
+    /// disjoint bucket range, so no synchronization on the destination is needed.
+    template <typename Source>
+    void insertFromTable(const Source & src, size_t begin_bucket, size_t end_bucket)
+    {
+        /// The zero key always lands in the zeroth bucket.
+        if (begin_bucket == 0 && src.m0.hasZero())
+            impls[0].m0.setHasZero(*src.m0.zeroValue());
+
+        auto fill_submap = [&](const auto & src_map, auto member_map)
+        {
+            for (auto & v : src_map)
+            {
+                size_t hash_value = v.getHash(src_map);
+                size_t buck = getBucketFromHash(hash_value);
+                if (buck >= begin_bucket && buck < end_bucket)
+                    (impls[buck].*member_map).insertUniqueNonZero(&v, hash_value);
+            }
+        };
+
+        fill_submap(src.m1, &Impl::m1);
+        fill_submap(src.m2, &Impl::m2);
+        fill_submap(src.m3, &Impl::m3);
+        fill_submap(src.ms, &Impl::ms);
+    }
+
     // This function is mostly the same as StringHashTable::dispatch, but with
     // added bucket computation. See the comments there.
     template <typename Self, typename Func, typename KeyHolder>
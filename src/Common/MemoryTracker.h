@@ -46,6 +46,20 @@ struct OvercommitTracker;
   * It throws an exception if amount of consumed memory become greater than certain limit.
   * The same memory tracker could be simultaneously used in different threads.
   *
+  * Trackers form a parent chain (thread -> query -> user -> total, with
+  * background_memory_tracker for merges/mutations), and that chain is the subsystem
+  * accounting that exists: the split between queries, background work and the rest is
+  * visible in system.metrics/system.processes. Caches are deliberately NOT children here -
+  * cache insertions happen on query threads, and charging them to the inserting query would
+  * make one tenant pay for pages every tenant reads; caches account globally via
+  * CurrentMetrics (*CacheBytes) and have fixed budgets instead. Reclaim callbacks invoked
+  * from allocation failure would run under the allocating thread in arbitrary lock context -
+  * an eviction that allocates or takes a cache mutex held by the OOM-ing thread deadlocks -
+  * which is why pressure handling is split differently: limits fail the *allocating* query
+  * (or a guilty one via OvercommitTracker's soft-limit arbitration), while cache sizing is a
+  * provisioning decision (cache_size_to_ram_max_ratio, per-cache size settings) rather than
+  * a panic response.
+  *
   * @see LockMemoryExceptionInThread
   * @see MemoryTrackerBlockerInThread
   */
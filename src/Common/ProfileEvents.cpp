@@ -44,6 +44,7 @@
     M(UncompressedCacheHits, "Number of times a block of data has been found in the uncompressed cache (and decompression was avoided).") \
     M(UncompressedCacheMisses, "Number of times a block of data has not been found in the uncompressed cache (and required decompression).") \
     M(UncompressedCacheWeightLost, "Number of bytes evicted from the uncompressed cache.") \
+    M(UncompressedCacheSharedLoads, "Number of times a block of data requested from the uncompressed cache was being decompressed by a concurrent reader, and its result was reused instead of decompressing the block again.") \
     M(MMappedFileCacheHits, "Number of times a file has been found in the MMap cache (for the 'mmap' read_method), so we didn't have to mmap it again.") \
     M(MMappedFileCacheMisses, "Number of times a file has not been found in the MMap cache (for the 'mmap' read_method), so we had to mmap it again.") \
     M(OpenedFileCacheHits, "Number of times a file has been found in the opened file cache, so we didn't have to open it again.") \
@@ -63,6 +64,10 @@
     M(MarkCacheMisses, "Number of times an entry has not been found in the mark cache, so we had to load a mark file in memory, which is a costly operation, adding to query latency.") \
     M(QueryCacheHits, "Number of times a query result has been found in the query cache (and query computation was avoided). Only updated for SELECT queries with SETTING use_query_cache = 1.") \
     M(QueryCacheMisses, "Number of times a query result has not been found in the query cache (and required query computation). Only updated for SELECT queries with SETTING use_query_cache = 1.") \
+    M(HashJoinCacheHits, "Number of times a built hash join right side has been found in the hash join cache (and the right table was not read again). Only updated with setting use_hash_join_cache = 1.") \
+    M(HashJoinCacheMisses, "Number of times a built hash join right side has not been found in the hash join cache. Only updated with setting use_hash_join_cache = 1.") \
+    M(PrewhereSelectivityCacheHits, "Number of times granules known to contain no rows matching the PREWHERE condition were found in the prewhere selectivity cache and were skipped without reading. Only updated with setting use_prewhere_selectivity_cache = 1.") \
+    M(PrewhereSelectivityCacheMisses, "Number of times no entry was found in the prewhere selectivity cache for a (data part, PREWHERE condition) pair. Only updated with setting use_prewhere_selectivity_cache = 1.") \
     /* Each page cache chunk access increments exactly one of the following 5 PageCacheChunk* counters. */ \
     /* Something like hit rate: (PageCacheChunkShared + PageCacheChunkDataHits) / [sum of all 5]. */ \
     M(PageCacheChunkMisses, "Number of times a chunk has not been found in the userspace page cache.") \
@@ -72,6 +77,7 @@
     M(PageCacheChunkDataMisses, "Number of times a chunk has been found in the userspace page cache, not in use, but all its pages were evicted by the OS.") \
     M(PageCacheBytesUnpinnedRoundedToPages, "Total size of populated pages in chunks that became evictable in PageCache. Rounded up to whole pages.") \
     M(PageCacheBytesUnpinnedRoundedToHugePages, "See PageCacheBytesUnpinnedRoundedToPages, but rounded to huge pages. Use the ratio between the two as a measure of memory waste from using huge pages.") \
+    M(AllocatorHugePageBytes, "Bytes of large allocations for which the kernel was advised to back the memory with transparent huge pages (MADV_HUGEPAGE).") \
     M(CreatedReadBufferOrdinary, "Number of times ordinary read buffer was created for reading data (while choosing among other read methods).") \
     M(CreatedReadBufferDirectIO, "Number of times a read buffer with O_DIRECT was created for reading data (while choosing among other read methods).") \
     M(CreatedReadBufferDirectIOFailed, "Number of times a read buffer with O_DIRECT was attempted to be created for reading data (while choosing among other read methods), but the OS did not allow it (due to lack of filesystem support or other reasons) and we fallen back to the ordinary reading method.") \
@@ -221,6 +227,16 @@
     M(MergeTreeDataProjectionWriterMergingBlocksMicroseconds, "Time spent merging blocks") \
     M(MutateTaskProjectionsCalculationMicroseconds, "Time spent calculating projections") \
     \
+    M(MergeMutateBackgroundExecutorQueueWaitMicroseconds, "Time tasks of the background executor for merges and mutations spent in the pending queue waiting for a thread") \
+    M(MoveBackgroundExecutorQueueWaitMicroseconds, "Time tasks of the background executor for moves spent in the pending queue waiting for a thread") \
+    M(FetchBackgroundExecutorQueueWaitMicroseconds, "Time tasks of the background executor for fetches spent in the pending queue waiting for a thread") \
+    M(CommonBackgroundExecutorQueueWaitMicroseconds, "Time tasks of the background executor for common operations (e.g. clearing old parts) spent in the pending queue waiting for a thread") \
+    \
+    M(MutationTotalParts, "Number of total parts for which mutations tried to be applied") \
+    M(MutationUntouchedParts, "Number of total parts for which mutations tried to be applied but which was completely skipped according to predicate") \
+    M(MutationAllPartColumns, "Number of times the mutation rewrote all columns of a part") \
+    M(MutationSomePartColumns, "Number of times the mutation rewrote only some columns of a part, hardlinking the files of the rest") \
+    \
     M(InsertedWideParts, "Number of parts inserted in Wide format.") \
     M(InsertedCompactParts, "Number of parts inserted in Compact format.") \
     M(MergedIntoWideParts, "Number of parts merged into Wide format.") \
@@ -304,6 +320,16 @@ The server successfully detected this situation and will download merged part fr
     M(SoftPageFaults, "The number of soft page faults in query execution threads. Soft page fault usually means a miss in the memory allocator cache, which requires a new memory mapping from the OS and subsequent allocation of a page of physical memory.") \
     M(HardPageFaults, "The number of hard page faults in query execution threads. High values indicate either that you forgot to turn off swap on your server, or eviction of memory pages of the ClickHouse binary during very high memory pressure, or successful usage of the 'mmap' read method for the tables data.") \
     \
+    /* Off-CPU ("why was the query waiting") time is decomposed across these counters rather */ \
+    /* than through a single futex-level hook, because a futex wrapper sees an address, not a */ \
+    /* reason. Each blocking seam reports under its own class: scheduler wait is */ \
+    /* OSCPUWaitMicroseconds (from taskstats, no eBPF needed), real disk wait is */ \
+    /* OSIOWaitMicroseconds / DiskReadElapsedMicroseconds, Keeper wait is */ \
+    /* ZooKeeperWaitMicroseconds, memory reclaim is MemoryOvercommitWaitTimeMicroseconds, */ \
+    /* lock classes have their own (RWLock*, part locks etc.), and all of it lands per query */ \
+    /* in system.query_log ProfileEvents. The residual formula real time - user - system - */ \
+    /* (the above) bounds whatever is not yet attributed; when that residual is large around */ \
+    /* a new blocking primitive, the fix is to add a counter at that seam, in the same way. */ \
     M(OSIOWaitMicroseconds, "Total time a thread spent waiting for a result of IO operation, from the OS point of view. This is real IO that doesn't include page cache.") \
     M(OSCPUWaitMicroseconds, "Total time a thread was ready for execution but waiting to be scheduled by OS, from the OS point of view.") \
     M(OSCPUVirtualTimeMicroseconds, "CPU time spent seen by OS. Does not include involuntary waits due to virtualization.") \
@@ -499,6 +525,7 @@ The server successfully detected this situation and will download merged part fr
     M(RemoteFSUnprefetchedReads, "Number of reads from unprefetched buffer") \
     M(RemoteFSUnprefetchedBytes, "Number of bytes from unprefetched buffer") \
     M(RemoteFSLazySeeks, "Number of lazy seeks") \
+    M(RemoteFSLazySeeksBytes, "Number of bytes read and discarded by lazy seeks to stay on the same connection instead of issuing a new remote read request") \
     M(RemoteFSSeeksWithReset, "Number of seeks which lead to a new connection") \
     M(RemoteFSBuffers, "Number of buffers created for asynchronous reading from remote filesystem") \
     M(MergeTreePrefetchedReadPoolInit, "Time spent preparing tasks in MergeTreePrefetchedReadPool") \
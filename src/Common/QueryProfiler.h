@@ -28,6 +28,17 @@ namespace DB
   *
   * Destructor tries to unset timer and restore previous signal handler.
   * Note that signal handler implementation is defined by template parameter. See QueryProfilerReal and QueryProfilerCPU.
+  *
+  * On continuous profiling: the write path is deliberately minimal - the signal handler
+  * records raw return addresses only, symbolization is deferred to whoever reads trace_log.
+  * Overhead is a pure function of query_profiler_{real,cpu}_time_period_ns; 10ms periods are
+  * well under 1% and safe to leave on fleet-wide, it is 1ms-and-below rates that flood the
+  * log. A separate in-memory per-query stack summary would duplicate what already composes:
+  * the flameGraph() aggregate function turns trace_log rows for one query_id into folded
+  * stacks directly (see AggregateFunctionFlameGraph.cpp for ready-made queries) - a single
+  * filter by query_id, not a join - and retention is trace_log's own TTL. Aggregating
+  * in-process would also move symbolization cost into the server's hot path, which is the
+  * exact trade this design avoids.
   */
 
 #ifndef __APPLE__
@@ -478,6 +478,16 @@ protected:
 };
 
 
+/// Multi-needle searcher behind the multiSearch* family. The shared n-gram hash table holds
+/// VolnitskyTraits::hash_size cells, so as the needle set grows past a few hundred entries the
+/// table saturates, collision chains lengthen and the scan step shrinks - throughput degrades
+/// smoothly rather than cliff-like, but large threat-feed-sized needle sets are better served
+/// by the Vectorscan-backed multiMatchAny family (needles escaped as literals, allow_hyperscan
+/// enabled), which compiles one DFA over all needles. Wiring Vectorscan underneath multiSearch*
+/// directly is not a drop-in swap: these functions promise byte positions and per-needle
+/// results under row-scoped case/UTF-8 semantics that the regex engine does not expose in its
+/// literal mode, and scanning the whole chars buffer in one pass would report matches that
+/// straddle row boundaries.
 template <bool CaseSensitive, bool ASCII, typename FallbackSearcher>
 class MultiVolnitskyBase
 {
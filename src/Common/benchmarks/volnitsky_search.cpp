@@ -0,0 +1,66 @@
+#include <Common/Volnitsky.h>
+#include <base/types.h>
+#include <benchmark/benchmark.h>
+
+#include <pcg_random.hpp>
+
+using namespace DB;
+
+/// Volnitsky substring search backs LIKE, position() and match() literal prescans;
+/// track it across needle lengths and match densities.
+
+static constexpr size_t HAYSTACK_SIZE = 1 << 20;
+
+static String mockHaystack(const String & needle, size_t matches)
+{
+    pcg64 rng(42);
+
+    String haystack;
+    haystack.resize(HAYSTACK_SIZE);
+    for (auto & c : haystack)
+        c = 'a' + rng() % 26;
+
+    for (size_t i = 0; i < matches; ++i)
+    {
+        size_t pos = rng() % (HAYSTACK_SIZE - needle.size());
+        haystack.replace(pos, needle.size(), needle);
+    }
+
+    return haystack;
+}
+
+static void BM_VolnitskySearch(benchmark::State & state)
+{
+    size_t needle_length = state.range(0);
+    size_t matches = state.range(1);
+
+    String needle;
+    for (size_t i = 0; i < needle_length; ++i)
+        needle += 'A' + i % 26;
+
+    String haystack = mockHaystack(needle, matches);
+
+    Volnitsky searcher(needle.data(), needle.size(), haystack.size());
+
+    for (auto _ : state)
+    {
+        const auto * pos = haystack.data();
+        const auto * end = haystack.data() + haystack.size();
+        size_t found = 0;
+
+        while (pos < end)
+        {
+            pos = searcher.search(pos, end - pos);
+            if (pos >= end)
+                break;
+            ++found;
+            pos += needle.size();
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetBytesProcessed(state.iterations() * HAYSTACK_SIZE);
+}
+
+BENCHMARK(BM_VolnitskySearch)->ArgsProduct({{4, 16, 64}, {0, 16, 1024}});
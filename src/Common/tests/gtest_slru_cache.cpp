@@ -207,3 +207,31 @@ TEST(SLRUCache, getOrSet)
     ASSERT_TRUE(value != nullptr);
     ASSERT_TRUE(*value == 5);
 }
+
+TEST(SLRUCache, sharded)
+{
+    using SimpleCacheBase = DB::CacheBase<int, int>;
+    auto slru_cache = SimpleCacheBase("SLRU", /*max_size_in_bytes=*/40, /*max_count=*/0, /*size_ratio*/0.5, /*num_shards=*/4);
+
+    for (int i = 0; i < 20; ++i)
+        slru_cache.set(i, std::make_shared<int>(i));
+
+    for (int i = 0; i < 20; ++i)
+    {
+        auto value = slru_cache.get(i);
+        ASSERT_TRUE(value != nullptr);
+        ASSERT_EQ(*value, i);
+    }
+
+    ASSERT_EQ(slru_cache.count(), 20);
+    ASSERT_EQ(slru_cache.sizeInBytes(), 20);
+    ASSERT_EQ(slru_cache.maxSizeInBytes(), 40);
+
+    slru_cache.remove(7);
+    ASSERT_TRUE(slru_cache.get(7) == nullptr);
+    ASSERT_EQ(slru_cache.count(), 19);
+
+    slru_cache.clear();
+    ASSERT_EQ(slru_cache.count(), 0);
+    ASSERT_EQ(slru_cache.sizeInBytes(), 0);
+}
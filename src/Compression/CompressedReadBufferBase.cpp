@@ -195,6 +195,12 @@ size_t CompressedReadBufferBase::readCompressedData(size_t & size_decompressed,
         compressed_in->readStrict(compressed_buffer + header_size, size_compressed_without_checksum - header_size);
     }
 
+    /// Verification has to happen here, on the consuming thread, and cannot be pushed down
+    /// into the prefetching readers (ThreadPoolReader, ThreadPoolRemoteFSReader): they operate
+    /// below the compression framing and see only opaque byte ranges, and a compressed block
+    /// regularly spans the boundary of a prefetched buffer. Overlapping the checksum cost with
+    /// query compute is instead achieved one level up, by reading different mark ranges on
+    /// different threads. If even that is too expensive, there is the `checksum_on_read` setting.
     if (!disable_checksum)
     {
         Checksum checksum;
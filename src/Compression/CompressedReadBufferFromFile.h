@@ -14,6 +14,14 @@ class MMappedFileCache;
 
 
 /// Unlike CompressedReadBuffer, it can do seek.
+///
+/// Decompression is performed on the thread that reads: the class is a synchronous ReadBuffer
+/// and must hand out blocks strictly in order, so it does not fan decompression out to a thread
+/// pool itself. Concurrency over compressed blocks is achieved one level higher, by reading the
+/// same file from several streams (pipeline parallelism over mark ranges, merge_max_threads for
+/// merges). The only in-buffer overlap is the Asynchronous codec mode used by readBig: codecs
+/// with hardware offload (e.g. DEFLATE_QPL) queue requests for consecutive blocks and the buffer
+/// flushes them in one batch; for software codecs it degrades to synchronous decompression.
 class CompressedReadBufferFromFile final : public CompressedReadBufferBase, public BufferWithOwnMemory<ReadBuffer>
 {
 private:
@@ -414,8 +414,11 @@ void decompressDataForType(const char * source, UInt32 source_size, char * dest,
         reader.skipBufferedBits(write_spec.prefix_bits); // discard the prefix value, since we've already used it
         if (write_spec.data_bits != 0)
         {
-            const UInt8 sign = reader.readBit();
-            double_delta = static_cast<UnsignedDeltaType>(reader.readBits(write_spec.data_bits - 1) + 1);
+            // The sign bit and the value are read with a single readBits() call to do one
+            // buffer refill check instead of two; the sign is the high bit of the result.
+            const UInt64 bits = reader.readBits(write_spec.data_bits);
+            const UInt8 sign = static_cast<UInt8>(bits >> (write_spec.data_bits - 1));
+            double_delta = static_cast<UnsignedDeltaType>((bits & maskLowBits<UInt64>(write_spec.data_bits - 1)) + 1);
             if (sign)
             {
                 /// It's well defined for unsigned data types.
@@ -310,8 +310,11 @@ void decompressDataForType(const char * source, UInt32 source_size, char * dest,
             if (reader.readBit() == 1)
             {
                 // 0b11 prefix
-                curr_xored_info.leading_zero_bits = reader.readBits(LEADING_ZEROES_BIT_LENGTH);
-                curr_xored_info.data_bits = reader.readBits(DATA_BIT_LENGTH);
+                // Both lengths are read with a single readBits() call to do one buffer refill
+                // check instead of two; the leading zeroes count occupies the high bits.
+                const auto lengths = reader.readBits(LEADING_ZEROES_BIT_LENGTH + DATA_BIT_LENGTH);
+                curr_xored_info.leading_zero_bits = static_cast<UInt8>(lengths >> DATA_BIT_LENGTH);
+                curr_xored_info.data_bits = static_cast<UInt8>(lengths & maskLowBits<UInt64>(DATA_BIT_LENGTH));
                 curr_xored_info.trailing_zero_bits = sizeof(T) * 8 - curr_xored_info.leading_zero_bits - curr_xored_info.data_bits;
             }
             // else: 0b10 prefix - use prev_xored_info
@@ -21,6 +21,14 @@ namespace ErrorCodes
 
 /**
 * Represents interface for compression codecs like LZ4, ZSTD, etc.
+*
+* Codecs must be stateless across blocks: every compressed block is self-contained and
+* decompressible given nothing but the block itself (its header carries the method byte and
+* sizes). Many things rely on this - blocks are checksummed and cached individually, readers
+* seek to an arbitrary block without replaying earlier ones, and getCompressionCodecForFile
+* infers the codec from a single block. A codec that needs out-of-band state shared between
+* blocks (e.g. a trained dictionary) would require a data part format change, not just a new
+* codec registration.
 */
 class ICompressionCodec : private boost::noncopyable
 {
@@ -127,6 +127,18 @@ void KeeperDispatcher::requestThread()
         /// process all already accumulated write requests, wait them synchronously and only after that process
         /// read request. So reads are some kind of "separator" for writes.
         /// Also there is a special reconfig request also being a separator.
+        ///
+        /// This separator role is the linearizability barrier, and it is what stops a
+        /// concurrent-read fast path from being a local change in this loop: a read is
+        /// correct only against state that includes every write this session has been acked
+        /// for, so reads can run concurrently with each other but must still order against
+        /// the write stream. Serving them from an immutable storage snapshot view would move
+        /// the barrier from the dispatcher into the state machine (publish a view per applied
+        /// batch), and SnapshotableHashTable's copy-on-write covers only the snapshotting
+        /// path today - it keeps one logical version plus archived nodes for an in-progress
+        /// snapshot, not a stack of readable versions. Until the state machine exposes such
+        /// views, read concurrency is capped by this single pipeline by design, not by
+        /// oversight.
         try
         {
             if (requests_queue->tryPop(request, max_wait))
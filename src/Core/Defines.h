@@ -102,6 +102,9 @@ static constexpr auto DEFAULT_QUERY_CACHE_MAX_SIZE = 1_GiB;
 static constexpr auto DEFAULT_QUERY_CACHE_MAX_ENTRIES = 1024uz;
 static constexpr auto DEFAULT_QUERY_CACHE_MAX_ENTRY_SIZE_IN_BYTES = 1_MiB;
 static constexpr auto DEFAULT_QUERY_CACHE_MAX_ENTRY_SIZE_IN_ROWS = 30'000'000uz;
+static constexpr auto DEFAULT_HASH_JOIN_CACHE_MAX_SIZE = 1_GiB;
+static constexpr auto DEFAULT_HASH_JOIN_CACHE_MAX_ENTRIES = 128uz;
+static constexpr auto DEFAULT_PREWHERE_SELECTIVITY_CACHE_MAX_SIZE = 128_MiB;
 
 /// Query profiler cannot work with sanitizers.
 /// Sanitizers are using quick "frame walking" stack unwinding (this implies -fno-omit-frame-pointer)
@@ -143,6 +143,17 @@ namespace Protocol
     }
 
     /// Packet types that client transmits.
+    ///
+    /// On PREPARE/EXECUTE packets: the protocol already carries parameterized queries - since
+    /// DBMS_MIN_PROTOCOL_VERSION_WITH_PARAMETERS the Query packet ships typed parameters
+    /// ({name:Type}) separately from the query text, so the repeated cost per request is
+    /// re-parsing and re-planning, not re-sending values. A server-side handle to a prepared
+    /// plan would only help if the plan were reusable across bindings, which it is not in this
+    /// codebase (see InterpreterFactory::get - literals are folded into the plan during
+    /// analysis). Without a reusable plan, a PREPARE handle would cache only the AST, saving a
+    /// fraction of a millisecond of parsing while adding session-pinned server state that
+    /// breaks connection-pool rotation and load-balancer failover. Revisit if planning ever
+    /// becomes parameter-agnostic.
     namespace Client
     {
         enum Enum
@@ -85,6 +85,22 @@ namespace SettingsChangesHistory
 /// It's used to implement `compatibility` setting (see https://github.com/ClickHouse/ClickHouse/issues/35972)
 static std::map<ClickHouseVersion, SettingsChangesHistory::SettingsChanges> settings_changes_history =
 {
+    {"24.5", {{"compress_sort_blocks_in_memory", false, false, "Allow to hold blocks accumulated for ORDER BY in compressed form"},
+              {"enable_adaptive_partial_aggregation_bypass", false, false, "Allow to skip partial aggregation when GROUP BY keys turn out to be nearly unique"},
+              {"distributed_aggregation_memory_efficient_force_two_level", false, false, "Allow to force two-level blocks from remote servers for memory-efficient distributed aggregation"},
+              {"allow_experimental_uniq_sketch_index", false, false, "Add new experimental uniq_sketch skipping index"},
+              {"query_cache_invalidate_on_data_change", false, false, "Allow to invalidate query cache entries when the data of the queried MergeTree tables changed"},
+              {"optimize_topk_aggregation", false, false, "Allow to rewrite GROUP BY key ORDER BY count() DESC LIMIT n queries to approx_top_k"},
+              {"join_runtime_bloom_filter_bytes", 0, 0, "New setting to filter probe-side rows of a hash join with a Bloom filter built from the right table keys"},
+              {"use_hash_join_cache", false, false, "New setting to share built hash join right sides between queries"},
+              {"query_plan_join_swap_table", false, false, "New setting to build the hash join hash table from the smaller side of an INNER JOIN"},
+              {"join_probe_read_ahead_bytes", 0, 0, "New setting to overlap the left-side scan warmup of a hash join with the build of the right side"},
+              {"query_plan_optimize_lazy_materialization", false, false, "New setting to defer reading of columns needed only in the result until after ORDER BY with LIMIT"},
+              {"query_plan_max_limit_for_lazy_materialization", 10, 10, "New setting to limit the LIMIT values for which lazy materialization can be applied"},
+              {"use_prewhere_selectivity_cache", false, false, "New setting to cache granules entirely filtered out by PREWHERE per immutable data part"},
+            {"squash_partition_blocks_on_insert", false, false, "New setting to combine per-partition sub-blocks of one INSERT before forming parts"},
+            {"rocksdb_bulk_insert", false, false, "New setting to write INSERTs into EmbeddedRocksDB tables as ingested SST files"},
+    }},
     {"24.4", {{"input_format_json_throw_on_bad_escape_sequence", true, true, "Allow to save JSON strings with bad escape sequences"},
               {"ignore_drop_queries_probability", 0, 0, "Allow to ignore drop queries in server with specified probability for testing purposes"},
               {"lightweight_deletes_sync", 2, 2, "The same as 'mutation_sync', but controls only execution of lightweight deletes"},
@@ -250,6 +250,16 @@ enum class CleanDeletedRows
 
 DECLARE_SETTING_ENUM(CleanDeletedRows)
 
+enum class MergeSelectorAlgorithm
+{
+    Simple = 0,
+    /// LSM-like leveling: merge fixed-size groups of parts of the minimum level.
+    /// Lowers write amplification at the cost of a higher number of parts.
+    Level,
+};
+
+DECLARE_SETTING_ENUM(MergeSelectorAlgorithm)
+
 enum class MySQLDataTypesSupport
 {
     DECIMAL, // convert MySQL's decimal and number to ClickHouse Decimal when applicable
@@ -37,6 +37,12 @@ bool canBeNativeType(const IDataType & type)
         return canBeNativeType(*data_type_nullable.getNestedType());
     }
 
+    /// Decimal is excluded even though Decimal32/64 are plain ints underneath: compiled
+    /// expressions may not throw, and checked Decimal arithmetic reports overflow and
+    /// division scale errors via exceptions from the middle of the loop. Representing the
+    /// value is the easy part (LLVM has i128/i256 too); the blockers are the error paths and
+    /// the scale bookkeeping of DecimalBinaryOperation, which depends on both operands'
+    /// scales per node and would have to be baked into every fused chain variant.
     return data_type.isNativeInt() || data_type.isNativeUInt() || data_type.isFloat() || data_type.isDate()
         || data_type.isDate32() || data_type.isDateTime() || data_type.isEnum();
 }
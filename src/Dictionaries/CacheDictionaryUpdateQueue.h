@@ -105,6 +105,18 @@ struct CacheDictionaryUpdateQueueConfiguration
 /** Responsibility of this class is to provide asynchronous and synchronous update support for CacheDictionary
 
     It is responsibility of CacheDictionary to perform update with UpdateUnit using UpdateFunction.
+
+    Note on scaling under cache-cold spikes: updates are not serialized through a single lock -
+    the queue is a ConcurrentBoundedQueue drained by max_threads_for_updates workers, and the
+    per-unit mutex below only guards the completion condvar. Negative caching also already
+    exists: keys the source does not return are written into storage as default cells and
+    expire with the regular lifetime, so repeated misses on absent keys are served from cache.
+    What is genuinely missing is cross-unit coalescing - two queries missing the same key at
+    the same moment each enqueue their own unit and both hit the source. Fixing that needs a
+    shared in-flight key map that later units subscribe to instead of enqueueing, which is a
+    different structure from sharding this queue; sharding alone would not remove the duplicate
+    source requests. Until then the practical mitigations are a larger max_threads_for_updates
+    and source-side connection pooling.
 */
 template <DictionaryKeyType dictionary_key_type>
 class CacheDictionaryUpdateQueue
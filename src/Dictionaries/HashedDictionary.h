@@ -885,6 +885,16 @@ void HashedDictionary<dictionary_key_type, sparse, sharded>::createAttributes()
         arena = std::make_unique<Arena>();
 }
 
+/// With update_field only the delta is fetched from the source (loadUpdatedAll), merged into
+/// the accumulated block, and replayed into a freshly constructed instance - the hash
+/// structure itself is still rebuilt on every reload. That is deliberate: lookups run lock-free
+/// against an immutable structure, and the atomic instance swap in ExternalLoader is the
+/// "versioned read view" - readers on the old version finish undisturbed while the new one is
+/// built. Upserting into the live structure instead would put synchronization on every getColumn
+/// call to protect against concurrent rehash, taxing all lookups to speed up reloads. The
+/// memory doubling during reload is the price of that trade; the levers that exist are sharded
+/// construction (shards > 1) to cut rebuild wall time and a source-side update_field query
+/// that returns only changed rows so the merge input stays small.
 template <DictionaryKeyType dictionary_key_type, bool sparse, bool sharded>
 void HashedDictionary<dictionary_key_type, sparse, sharded>::updateData()
 {
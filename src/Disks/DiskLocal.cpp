@@ -1,4 +1,5 @@
 #include "DiskLocal.h"
+#include <Common/CurrentThread.h>
 #include <Common/Throttler_fwd.h>
 #include <Common/createHardLink.h>
 #include "DiskFactory.h"
@@ -328,10 +329,40 @@ void DiskLocal::replaceFile(const String & from_path, const String & to_path)
     fs::rename(from_file, to_file);
 }
 
+String DiskLocal::getReadResourceName() const
+{
+    std::unique_lock lock(resource_mutex);
+    return read_resource_name;
+}
+
+String DiskLocal::getWriteResourceName() const
+{
+    std::unique_lock lock(resource_mutex);
+    return write_resource_name;
+}
+
+/// Returns a resource link of the query workload for the given resource, if both are known.
+static ResourceLink getResourceLink(const String & resource_name)
+{
+    if (resource_name.empty())
+        return {};
+    if (auto query_context = CurrentThread::getQueryContext())
+        return query_context->getWorkloadClassifier()->get(resource_name);
+    return {};
+}
+
 std::unique_ptr<ReadBufferFromFileBase> DiskLocal::readFile(const String & path, const ReadSettings & settings, std::optional<size_t> read_hint, std::optional<size_t> file_size) const
 {
     if (!file_size.has_value())
         file_size = fileSizeSafe(fs::path(disk_path) / path);
+
+    if (ResourceLink link = getResourceLink(getReadResourceName()); link.queue)
+    {
+        ReadSettings scheduled_settings(settings);
+        scheduled_settings.resource_link = link;
+        return createReadBufferFromFileBase(fs::path(disk_path) / path, scheduled_settings, read_hint, file_size);
+    }
+
     return createReadBufferFromFileBase(fs::path(disk_path) / path, settings, read_hint, file_size);
 }
 
@@ -339,8 +370,13 @@ std::unique_ptr<WriteBufferFromFileBase>
 DiskLocal::writeFile(const String & path, size_t buf_size, WriteMode mode, const WriteSettings & settings)
 {
     int flags = (mode == WriteMode::Append) ? (O_APPEND | O_CREAT | O_WRONLY) : -1;
-    return std::make_unique<WriteBufferFromFile>(
+    auto res = std::make_unique<WriteBufferFromFile>(
         fs::path(disk_path) / path, buf_size, flags, settings.local_throttler);
+
+    if (ResourceLink link = getResourceLink(getWriteResourceName()); link.queue)
+        res->setResourceLink(link);
+
+    return res;
 }
 
 std::vector<String> DiskLocal::getBlobPath(const String & path) const
@@ -466,6 +502,14 @@ void DiskLocal::applyNewSettings(const Poco::Util::AbstractConfiguration & confi
     if (keep_free_space_bytes != new_keep_free_space_bytes)
         keep_free_space_bytes = new_keep_free_space_bytes;
 
+    {
+        std::unique_lock lock(resource_mutex);
+        if (String new_read_resource_name = config.getString(config_prefix + ".read_resource", ""); new_read_resource_name != read_resource_name)
+            read_resource_name = new_read_resource_name;
+        if (String new_write_resource_name = config.getString(config_prefix + ".write_resource", ""); new_write_resource_name != write_resource_name)
+            write_resource_name = new_write_resource_name;
+    }
+
     IDisk::applyNewSettings(config, context, config_prefix, disk_map);
 }
 
@@ -476,6 +520,8 @@ DiskLocal::DiskLocal(const String & name_, const String & path_, UInt64 keep_fre
     , keep_free_space_bytes(keep_free_space_bytes_)
     , logger(getLogger("DiskLocal"))
     , data_source_description(getLocalDataSourceDescription(disk_path))
+    , read_resource_name(config.getString(config_prefix + ".read_resource", ""))
+    , write_resource_name(config.getString(config_prefix + ".write_resource", ""))
 {
 }
 
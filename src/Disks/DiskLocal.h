@@ -150,6 +150,9 @@ private:
     /// Read magic number from disk checker file. Return std::nullopt if exception happens.
     std::optional<UInt32> readDiskCheckerMagicNumber() const noexcept;
 
+    String getReadResourceName() const;
+    String getWriteResourceName() const;
+
     const String disk_path;
     const String disk_checker_path = ".disk_checker_file";
     std::atomic<UInt64> keep_free_space_bytes;
@@ -161,6 +164,12 @@ private:
 
     static std::mutex reservation_mutex;
 
+    /// Names of resources in the IO scheduler hierarchy that reads and writes of this disk
+    /// consume (empty means the disk is not enrolled into the scheduler).
+    mutable std::mutex resource_mutex;
+    String read_resource_name;
+    String write_resource_name;
+
     std::atomic<bool> broken{false};
     std::atomic<bool> readonly{false};
     std::unique_ptr<DiskLocalCheckThread> disk_checker;
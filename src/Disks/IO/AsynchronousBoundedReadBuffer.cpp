@@ -29,6 +29,7 @@ namespace ProfileEvents
     extern const Event RemoteFSPrefetchedBytes;
     extern const Event RemoteFSUnprefetchedBytes;
     extern const Event RemoteFSLazySeeks;
+    extern const Event RemoteFSLazySeeksBytes;
     extern const Event RemoteFSSeeksWithReset;
     extern const Event RemoteFSBuffers;
 }
@@ -339,6 +340,7 @@ off_t AsynchronousBoundedReadBuffer::seek(off_t offset, int whence)
     {
         ProfileEvents::increment(ProfileEvents::RemoteFSLazySeeks);
         bytes_to_ignore = new_pos - file_offset_of_buffer_end;
+        ProfileEvents::increment(ProfileEvents::RemoteFSLazySeeksBytes, bytes_to_ignore);
     }
     else
     {
@@ -17,6 +17,13 @@ struct AsyncReadCounters;
 using AsyncReadCountersPtr = std::shared_ptr<AsyncReadCounters>;
 class ReadBufferFromRemoteFSGather;
 
+/// A single-prefetch asynchronous buffer: at most one read request is in flight, issued for
+/// the next contiguous range via prefetch(). Download concurrency is deliberately layered
+/// above, not inside, this class: MergeTreePrefetchedReadPool runs many of these buffers at
+/// once (bounded by filesystem_prefetches_limit / filesystem_prefetch_max_memory_usage), and
+/// flat large-object streams that want parallel ranged GETs over one file use
+/// ParallelReadBuffer instead. Keeping this class single-request is what makes its
+/// seek/ignore/read-until-position bookkeeping tractable.
 class AsynchronousBoundedReadBuffer : public ReadBufferFromFileBase
 {
 public:
@@ -135,11 +135,11 @@ std::future<IAsynchronousReader::Result> IOUringReader::submit(Request request)
     }
 }
 
-int IOUringReader::submitToRing(EnqueuedRequest & enqueued)
+bool IOUringReader::prepareSubmission(EnqueuedRequest & enqueued)
 {
     struct io_uring_sqe * sqe = io_uring_get_sqe(&ring);
     if (!sqe)
-        return 0;
+        return false;
 
     auto request = enqueued.request;
     auto request_id = reinterpret_cast<UInt64>(request.buf);
@@ -147,6 +147,19 @@ int IOUringReader::submitToRing(EnqueuedRequest & enqueued)
 
     io_uring_sqe_set_data64(sqe, request_id);
     io_uring_prep_read(sqe, fd, request.buf, static_cast<unsigned>(request.size - enqueued.bytes_read), request.offset + enqueued.bytes_read);
+
+    if (!enqueued.resubmitting)
+    {
+        ProfileEvents::increment(ProfileEvents::IOUringSQEsSubmitted);
+        CurrentMetrics::add(CurrentMetrics::IOUringInFlightEvents);
+        CurrentMetrics::add(CurrentMetrics::Read);
+    }
+
+    return true;
+}
+
+int IOUringReader::flushSubmissions()
+{
     int ret = 0;
 
     do
@@ -154,25 +167,34 @@ int IOUringReader::submitToRing(EnqueuedRequest & enqueued)
         ret = io_uring_submit(&ring);
     } while (ret == -EINTR || ret == -EAGAIN);
 
-    if (ret > 0 && !enqueued.resubmitting)
+    return ret;
+}
+
+int IOUringReader::submitToRing(EnqueuedRequest & enqueued)
+{
+    if (!prepareSubmission(enqueued))
+        return 0;
+
+    int ret = flushSubmissions();
+    if (ret <= 0 && !enqueued.resubmitting)
     {
-        ProfileEvents::increment(ProfileEvents::IOUringSQEsSubmitted);
-        CurrentMetrics::add(CurrentMetrics::IOUringInFlightEvents);
-        CurrentMetrics::add(CurrentMetrics::Read);
+        /// The request will not reach the completion path which normally updates these metrics.
+        CurrentMetrics::sub(CurrentMetrics::IOUringInFlightEvents);
+        CurrentMetrics::sub(CurrentMetrics::Read);
     }
 
     return ret;
 }
 
-void IOUringReader::failRequest(const EnqueuedIterator & requestIt, const Exception & ex)
+void IOUringReader::failRequest(const EnqueuedIterator & requestIt, const Exception & ex, std::vector<UInt64> * prepared_ids)
 {
     ProfileEvents::increment(ProfileEvents::ReadBufferFromFileDescriptorReadFailed);
     (requestIt->second).promise.set_exception(std::make_exception_ptr(ex));
 
-    finalizeRequest(requestIt);
+    finalizeRequest(requestIt, prepared_ids);
 }
 
-void IOUringReader::finalizeRequest(const EnqueuedIterator & requestIt)
+void IOUringReader::finalizeRequest(const EnqueuedIterator & requestIt, std::vector<UInt64> * prepared_ids)
 {
     in_flight_requests.erase(requestIt);
 
@@ -186,21 +208,39 @@ void IOUringReader::finalizeRequest(const EnqueuedIterator & requestIt)
         auto pending_request = std::move(pending_requests.front());
         pending_requests.pop_front();
 
-        int ret = submitToRing(pending_request);
-        if (ret > 0)
+        auto request_id = reinterpret_cast<UInt64>(pending_request.request.buf);
+        if (in_flight_requests.contains(request_id))
+        {
+            failPromise(pending_request.promise, Exception(ErrorCodes::LOGICAL_ERROR,
+                "Tried enqueuing pending read request for {} that is already submitted", request_id));
+        }
+        else if (prepared_ids)
         {
-            auto request_id = reinterpret_cast<UInt64>(pending_request.request.buf);
-            if (!in_flight_requests.contains(request_id))
+            if (prepareSubmission(pending_request))
+            {
+                prepared_ids->push_back(request_id);
                 in_flight_requests.emplace(request_id, std::move(pending_request));
+            }
             else
-                failPromise(pending_request.promise, Exception(ErrorCodes::LOGICAL_ERROR,
-                    "Tried enqueuing pending read request for {} that is already submitted", request_id));
+            {
+                ProfileEvents::increment(ProfileEvents::ReadBufferFromFileDescriptorReadFailed);
+                failPromise(pending_request.promise, Exception(ErrorCodes::IO_URING_SUBMIT_ERROR,
+                    "Failed submitting SQE for pending request: no SQE available"));
+            }
         }
         else
         {
-            ProfileEvents::increment(ProfileEvents::ReadBufferFromFileDescriptorReadFailed);
-            failPromise(pending_request.promise, Exception(ErrorCodes::IO_URING_SUBMIT_ERROR,
-                "Failed submitting SQE for pending request: {}", ret < 0 ? errnoToString(-ret) : "no SQE submitted"));
+            int ret = submitToRing(pending_request);
+            if (ret > 0)
+            {
+                in_flight_requests.emplace(request_id, std::move(pending_request));
+            }
+            else
+            {
+                ProfileEvents::increment(ProfileEvents::ReadBufferFromFileDescriptorReadFailed);
+                failPromise(pending_request.promise, Exception(ErrorCodes::IO_URING_SUBMIT_ERROR,
+                    "Failed submitting SQE for pending request: {}", ret < 0 ? errnoToString(-ret) : "no SQE submitted"));
+            }
         }
 
         CurrentMetrics::sub(CurrentMetrics::IOUringPendingEvents);
@@ -251,83 +291,112 @@ void IOUringReader::monitorRing()
         // it is safe to re-submit events once we take the lock here
         std::unique_lock lock{mutex};
 
-        auto request_id = cqe->user_data;
-        const auto it = in_flight_requests.find(request_id);
-        if (it == in_flight_requests.end())
+        // Drain all completion events that are already available without going back to
+        // io_uring_wait_cqe(), and flush the read requests prepared while processing them
+        // (resubmits and pending requests) with a single io_uring_submit() at the end.
+        std::vector<UInt64> prepared_ids;
+        while (true)
         {
-            LOG_ERROR(log, "Got a completion event for a request {} that was not submitted", request_id);
-
+            processCompletionEvent(cqe, prepared_ids);
             io_uring_cqe_seen(&ring, cqe);
-            continue;
-        }
 
-        auto & enqueued = it->second;
+            // a noop event with zero user_data is left in the queue for the outer loop
+            // which knows how to shut the thread down
+            if (io_uring_peek_cqe(&ring, &cqe) != 0 || !cqe || cqe->user_data == 0)
+                break;
+        }
 
-        if (cqe->res == -EAGAIN || cqe->res == -EINTR)
+        if (!prepared_ids.empty())
         {
-            enqueued.resubmitting = true;
-            ProfileEvents::increment(ProfileEvents::IOUringSQEsResubmits);
-
-            ret = submitToRing(enqueued);
+            ret = flushSubmissions();
             if (ret <= 0)
             {
-                failRequest(it, Exception(ErrorCodes::IO_URING_SUBMIT_ERROR,
-                    "Failed re-submitting SQE: {}", ret < 0 ? errnoToString(-ret) : "no SQE submitted"));
+                // The prepared SQEs stay in the submission queue and may be flushed later with
+                // an unrelated submission, but the requests are failed right away: completion
+                // events for request ids that are no longer in flight are simply ignored.
+                for (auto request_id : prepared_ids)
+                {
+                    const auto it = in_flight_requests.find(request_id);
+                    if (it != in_flight_requests.end())
+                        failRequest(it, Exception(ErrorCodes::IO_URING_SUBMIT_ERROR,
+                            "Failed submitting SQEs: {}", ret < 0 ? errnoToString(-ret) : "no SQE submitted"));
+                }
             }
-
-            io_uring_cqe_seen(&ring, cqe);
-            continue;
         }
+    }
+}
 
-        if (cqe->res < 0)
-        {
-            auto req = enqueued.request;
-            int fd = assert_cast<const LocalFileDescriptor &>(*req.descriptor).fd;
-            failRequest(it, Exception(
-                ErrorCodes::CANNOT_READ_FROM_FILE_DESCRIPTOR,
-                "Failed reading {} bytes at offset {} to address {} from fd {}: {}",
-                req.size, req.offset, static_cast<void*>(req.buf), fd, errnoToString(-cqe->res)
-            ));
-
-            ProfileEvents::increment(ProfileEvents::IOUringCQEsFailed);
-            io_uring_cqe_seen(&ring, cqe);
-            continue;
-        }
+void IOUringReader::processCompletionEvent(const struct io_uring_cqe * cqe, std::vector<UInt64> & prepared_ids)
+{
+    auto request_id = cqe->user_data;
+    const auto it = in_flight_requests.find(request_id);
+    if (it == in_flight_requests.end())
+    {
+        LOG_ERROR(log, "Got a completion event for a request {} that was not submitted", request_id);
+        return;
+    }
 
-        size_t bytes_read = cqe->res;
-        size_t total_bytes_read = enqueued.bytes_read + bytes_read;
+    auto & enqueued = it->second;
 
-        if (bytes_read > 0)
-        {
-            __msan_unpoison(enqueued.request.buf + enqueued.bytes_read, bytes_read);
+    if (cqe->res == -EAGAIN || cqe->res == -EINTR)
+    {
+        enqueued.resubmitting = true;
+        ProfileEvents::increment(ProfileEvents::IOUringSQEsResubmits);
 
-            ProfileEvents::increment(ProfileEvents::ReadBufferFromFileDescriptorRead);
-            ProfileEvents::increment(ProfileEvents::ReadBufferFromFileDescriptorReadBytes, bytes_read);
-        }
+        if (prepareSubmission(enqueued))
+            prepared_ids.push_back(request_id);
+        else
+            failRequest(it, Exception(ErrorCodes::IO_URING_SUBMIT_ERROR,
+                "Failed re-submitting SQE: no SQE available"), &prepared_ids);
 
-        if (bytes_read > 0 && total_bytes_read < enqueued.request.size)
-        {
-            // potential short read, re-submit
-            enqueued.resubmitting = true;
-            enqueued.bytes_read += bytes_read;
+        return;
+    }
 
-            ret = submitToRing(enqueued);
-            if (ret <= 0)
-            {
-                failRequest(it, Exception(ErrorCodes::IO_URING_SUBMIT_ERROR,
-                    "Failed re-submitting SQE for short read: {}", ret < 0 ? errnoToString(-ret) : "no SQE submitted"));
-            }
-        }
-        else
-        {
-            ProfileEvents::increment(ProfileEvents::AsynchronousReaderIgnoredBytes, enqueued.request.ignore);
-            enqueued.promise.set_value(Result{ .size = total_bytes_read, .offset = enqueued.request.ignore });
-            finalizeRequest(it);
-        }
+    if (cqe->res < 0)
+    {
+        auto req = enqueued.request;
+        int fd = assert_cast<const LocalFileDescriptor &>(*req.descriptor).fd;
+        failRequest(it, Exception(
+            ErrorCodes::CANNOT_READ_FROM_FILE_DESCRIPTOR,
+            "Failed reading {} bytes at offset {} to address {} from fd {}: {}",
+            req.size, req.offset, static_cast<void*>(req.buf), fd, errnoToString(-cqe->res)
+        ), &prepared_ids);
+
+        ProfileEvents::increment(ProfileEvents::IOUringCQEsFailed);
+        return;
+    }
 
-        ProfileEvents::increment(ProfileEvents::IOUringCQEsCompleted);
-        io_uring_cqe_seen(&ring, cqe);
+    size_t bytes_read = cqe->res;
+    size_t total_bytes_read = enqueued.bytes_read + bytes_read;
+
+    if (bytes_read > 0)
+    {
+        __msan_unpoison(enqueued.request.buf + enqueued.bytes_read, bytes_read);
+
+        ProfileEvents::increment(ProfileEvents::ReadBufferFromFileDescriptorRead);
+        ProfileEvents::increment(ProfileEvents::ReadBufferFromFileDescriptorReadBytes, bytes_read);
+    }
+
+    if (bytes_read > 0 && total_bytes_read < enqueued.request.size)
+    {
+        // potential short read, re-submit
+        enqueued.resubmitting = true;
+        enqueued.bytes_read += bytes_read;
+
+        if (prepareSubmission(enqueued))
+            prepared_ids.push_back(request_id);
+        else
+            failRequest(it, Exception(ErrorCodes::IO_URING_SUBMIT_ERROR,
+                "Failed re-submitting SQE for short read: no SQE available"), &prepared_ids);
     }
+    else
+    {
+        ProfileEvents::increment(ProfileEvents::AsynchronousReaderIgnoredBytes, enqueued.request.ignore);
+        enqueued.promise.set_value(Result{ .size = total_bytes_read, .offset = enqueued.request.ignore });
+        finalizeRequest(it, &prepared_ids);
+    }
+
+    ProfileEvents::increment(ProfileEvents::IOUringCQEsCompleted);
 }
 
 IOUringReader::~IOUringReader()
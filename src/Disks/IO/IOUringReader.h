@@ -52,13 +52,23 @@ private:
     std::deque<EnqueuedRequest> pending_requests;
     std::unordered_map<UInt64, EnqueuedRequest> in_flight_requests;
 
+    /// Prepare an SQE for the request without submitting it to the kernel.
+    /// Returns false if no SQE is available.
+    bool prepareSubmission(EnqueuedRequest & enqueued);
+    /// Submit all prepared SQEs with a single syscall.
+    int flushSubmissions();
+    /// prepareSubmission() + flushSubmissions() for a single request.
     int submitToRing(EnqueuedRequest & enqueued);
 
     using EnqueuedIterator = std::unordered_map<UInt64, EnqueuedRequest>::iterator;
 
-    void failRequest(const EnqueuedIterator & requestIt, const Exception & ex);
-    void finalizeRequest(const EnqueuedIterator & requestIt);
+    /// If `prepared_ids` is not nullptr, read requests (re)submitted while handling the current
+    /// request are only prepared and recorded there; the caller flushes them in one batch.
+    /// Otherwise they are submitted to the kernel immediately.
+    void failRequest(const EnqueuedIterator & requestIt, const Exception & ex, std::vector<UInt64> * prepared_ids = nullptr);
+    void finalizeRequest(const EnqueuedIterator & requestIt, std::vector<UInt64> * prepared_ids = nullptr);
 
+    void processCompletionEvent(const struct io_uring_cqe * cqe, std::vector<UInt64> & prepared_ids);
     void monitorRing();
 
     template<typename T> inline void failPromise(std::promise<T> & promise, const Exception & ex)
@@ -7,8 +7,15 @@
 #include <IO/ReadSettings.h>
 #include <IO/SwapHelper.h>
 #include <Interpreters/FilesystemCacheLog.h>
+#include <Common/ProfileEvents.h>
 #include <Common/logger_useful.h>
 
+namespace ProfileEvents
+{
+    extern const Event RemoteFSLazySeeks;
+    extern const Event RemoteFSLazySeeksBytes;
+}
+
 using namespace DB;
 
 
@@ -267,6 +274,8 @@ off_t ReadBufferFromRemoteFSGather::seek(off_t offset, int whence)
             size_t diff = offset - position;
             if (diff < settings.remote_read_min_bytes_for_seek)
             {
+                ProfileEvents::increment(ProfileEvents::RemoteFSLazySeeks);
+                ProfileEvents::increment(ProfileEvents::RemoteFSLazySeeksBytes, diff);
                 ignore(diff);
                 return offset;
             }
@@ -153,6 +153,17 @@ std::unique_ptr<ReadBufferFromFileBase> createReadBufferFromFileBase(
         else
             throw Exception(ErrorCodes::LOGICAL_ERROR, "Unknown read method");
 
+        /// Enroll the buffer into the IO scheduler if the caller (e.g. a disk with a configured
+        /// `read_resource`) provided a resource link. The mmap path above is not covered: page
+        /// faults cannot be accounted before they happen.
+        if (settings.resource_link.queue)
+        {
+            if (auto * fd_buffer = dynamic_cast<ReadBufferFromFileDescriptor *>(res.get()))
+                fd_buffer->setResourceLink(settings.resource_link);
+            else if (auto * async_buffer = dynamic_cast<AsynchronousReadBufferFromFileDescriptor *>(res.get()))
+                async_buffer->setResourceLink(settings.resource_link);
+        }
+
         return res;
     };
 
@@ -54,7 +54,16 @@ public:
         throwNotImplemented();
     }
 
-    /// Writes the data inline with the metadata
+    /// Writes the data inline with the metadata.
+    ///
+    /// This is the intended mechanism for the small per-part files of MergeTree
+    /// (checksums.txt, columns.txt, count.txt, ...) on object storage: storing their content
+    /// inside the local metadata file would avoid one PUT and one GET per file per part.
+    /// The serialization format already supports it (DiskObjectStorageMetadata
+    /// VERSION_INLINE_DATA), but the mechanism is not wired into the disk read path yet:
+    /// DiskObjectStorage::readFile always resolves storage objects and knows nothing about
+    /// inline content, and neither do fetches, checks and backups. Until all readers handle
+    /// it, nothing must write part data inline.
     virtual void writeInlineDataToFile(const std::string & /* path */, const std::string & /* data */)
     {
         throwNotImplemented();
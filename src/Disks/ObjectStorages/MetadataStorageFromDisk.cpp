@@ -169,6 +169,13 @@ void MetadataStorageFromDiskTransaction::addOperation(MetadataOperationPtr && op
     operations.emplace_back(std::move(operation));
 }
 
+/// The transaction already stages everything in memory: operations only accumulate until
+/// commit(), and are then applied serially under the exclusive metadata mutex with undo-based
+/// rollback on failure. Note that the per-operation file writes are not individually fsynced -
+/// there is no fsync amplification here to batch away. Replacing the apply loop with a single
+/// WAL record would buy atomicity across operations (today a crash mid-commit can leave a
+/// prefix applied), but it requires replay on startup and coordination with the object storage
+/// blobs the metadata points to, so it is a metadata format change rather than a local rewrite.
 void MetadataStorageFromDiskTransaction::commit()
 {
     if (state != MetadataFromDiskTransactionState::PREPARING)
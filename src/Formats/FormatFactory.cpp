@@ -467,6 +467,16 @@ static void addExistingProgressToOutputFormat(OutputFormatPtr format, const Cont
     }
 }
 
+/// Parallel output formatting (the counterpart of ParallelParsingInputFormat) is already the
+/// default here: every row-based format that registered via
+/// markOutputFormatSupportsParallelFormatting - JSONEachRow, CSV, TSV and friends - gets
+/// wrapped into ParallelFormattingOutputFormat, which formats chunks on max_threads workers
+/// and stitches the results back in order. The choice is made once, before the first byte is
+/// written: switching to the parallel wrapper mid-stream based on observed output rate is not
+/// possible because the plain formatter owns the output buffer and its header/row state, and
+/// the wrapper needs to own chunk ordering from the start. The wrapper is cheap when the
+/// query is not format-bound (workers simply stay idle), so a static default-on covers the
+/// adaptive case well enough.
 OutputFormatPtr FormatFactory::getOutputFormatParallelIfPossible(
     const String & name,
     WriteBuffer & buf,
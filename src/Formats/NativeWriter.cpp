@@ -84,6 +84,14 @@ size_t NativeWriter::write(const Block & block)
 
     /** The index has the same structure as the data stream.
       * But instead of column values, it contains a mark that points to the location in the data file where this part of the column is located.
+      *
+      * In index mode every column additionally starts at a fresh compressed block (see
+      * ostr_concrete->next() below), which makes columns independently addressable: a reader
+      * with the index seeks to a column's mark and decompresses only that column (this is how
+      * StripeLog reads a subset of columns). The same per-column framing is deliberately not
+      * used on the interserver wire: the remote side executes the shard plan and only ever
+      * sends columns the initiator asked for, so there is nothing to skip, and finishing a
+      * compressed frame per column would shrink frames and hurt the ratio for narrow blocks.
       */
     IndexOfBlockForNativeFormat index_block;
     if (index)
@@ -19,6 +19,14 @@ using DataTypes = std::vector<DataTypePtr>;
 class WriteBuffer;
 
 /// Utility class, does all the work for serialization in the Protobuf format.
+///
+/// The serializer tree is compiled from the schema once in create(): every (field type,
+/// column type) pair gets its own concrete serializer object, so per-row work is one virtual
+/// call per field into straight-line type-specific code - the descriptor is never walked
+/// again. Flattening the remaining per-field virtual calls (via a dispatch table or the
+/// expression JIT) was weighed and dropped: wire-format decoding inside each call dominates
+/// the call overhead, and the JIT infrastructure is scoped to expressions, with compilation
+/// latency that would be paid per Kafka consumer setup.
 class ProtobufSerializer
 {
 public:
@@ -217,6 +217,15 @@ checkAndGetNestedArrayOffset(const IColumn ** columns, size_t num_arguments)
     return {nested_columns, offsets->data()};
 }
 
+/// Note on the cost of this wrapping: with a single Nullable argument the result SHARES the
+/// argument's null-map column (COW pointer copy - no allocation and no per-row write), so the
+/// common all-non-null column flows through whole function chains reusing one zero map.
+/// A fresh map is allocated only by makeNullable() when no argument carried one, and the
+/// byte-wise OR below runs only when two or more non-const Nullable arguments meet, where a
+/// merged map is genuinely a new value. That makes a dedicated "all non-null" singleton mask
+/// mostly redundant: the sharing already collapses the per-call cost to a refcount bump, and
+/// a mutable flag on ColumnNullable would have to stay correct under COW mutations of the
+/// nested data, which is exactly the kind of cross-invariant IColumn avoids.
 ColumnPtr wrapInNullable(const ColumnPtr & src, const ColumnsWithTypeAndName & args, const DataTypePtr & result_type, size_t input_rows_count)
 {
     ColumnPtr result_null_map_column;
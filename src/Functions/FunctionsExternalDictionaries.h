@@ -350,6 +350,13 @@ public:
             return {0, 1};
     }
 
+    /// Non-determinism (the dictionary may be reloaded mid-query) has a performance side
+    /// effect worth knowing: it disables execution on a LowCardinality key's own dictionary,
+    /// which is exactly the probe-unique-keys-once-and-expand strategy - LC keys are
+    /// materialized to a full column and every repeated key is probed again. The lookup
+    /// itself is already a batch call (the whole key column goes down to the dictionary in
+    /// one getColumn() and is probed in a tight loop), so key deduplication, not call
+    /// granularity, is what repetition-heavy enrichment workloads are missing.
     bool isDeterministic() const override { return false; }
 
     bool isInjective(const ColumnsWithTypeAndName & sample_columns) const override
@@ -47,6 +47,15 @@ bool allArgumentsAreConstants(const ColumnsWithTypeAndName & args)
     return true;
 }
 
+/// Rewrites the single LowCardinality argument to its dictionary so the function runs once
+/// per distinct value; constants are resized alongside, and the caller re-indexes the result.
+/// Multiple LowCardinality arguments intentionally fall back to full columns (see the caller):
+/// the generalization - evaluating on the cross product of dictionaries and gathering by a
+/// combined index - is only a win when |dict_a| * |dict_b| stays well under the row count,
+/// and computing the combined index is itself a per-row hash/join over both index columns,
+/// i.e. comparable to the per-row work being saved for cheap functions. For the expensive
+/// functions where memoization would pay, the distinct-pair set is rarely small, which is why
+/// the cutover never materialized beyond the single-dictionary case.
 ColumnPtr replaceLowCardinalityColumnsByNestedAndGetDictionaryIndexes(
     ColumnsWithTypeAndName & args, bool can_be_executed_on_default_arguments, size_t input_rows_count)
 {
@@ -318,7 +327,12 @@ ColumnPtr IExecutableFunction::execute(const ColumnsWithTypeAndName & arguments,
     {
         size_t num_sparse_columns = 0;
         size_t num_full_columns = 0;
-        size_t sparse_column_position = 0;
+
+        /// Whether all sparse arguments share the same offsets. This is the case for
+        /// a column read from a part and for results of sparse-preserving functions over it,
+        /// so sparsity can be propagated through chains of such functions without materialization.
+        bool sparse_offsets_are_same = true;
+        const IColumn * common_sparse_offsets = nullptr;
 
         for (size_t i = 0; i < arguments.size(); ++i)
         {
@@ -327,7 +341,10 @@ ColumnPtr IExecutableFunction::execute(const ColumnsWithTypeAndName & arguments,
             /// it's more convenient to convert it to full before execution of function.
             if (column_sparse && column_sparse->getNumberOfDefaultRows())
             {
-                sparse_column_position = i;
+                if (common_sparse_offsets && common_sparse_offsets != &column_sparse->getOffsetsColumn())
+                    sparse_offsets_are_same = false;
+
+                common_sparse_offsets = &column_sparse->getOffsetsColumn();
                 ++num_sparse_columns;
             }
             else if (!isColumnConst(*arguments[i].column))
@@ -337,21 +354,27 @@ ColumnPtr IExecutableFunction::execute(const ColumnsWithTypeAndName & arguments,
         }
 
         auto columns_without_sparse = arguments;
-        if (num_sparse_columns == 1 && num_full_columns == 0)
+        if (num_sparse_columns > 0 && num_full_columns == 0 && sparse_offsets_are_same)
         {
-            auto & arg_with_sparse = columns_without_sparse[sparse_column_position];
             ColumnPtr sparse_offsets;
+            size_t values_size = 0;
+            std::vector<UInt8> is_replaced_by_values(columns_without_sparse.size(), false);
+
+            for (size_t i = 0; i < columns_without_sparse.size(); ++i)
             {
-                /// New scope to avoid possible mistakes on dangling reference.
-                const auto & column_sparse = assert_cast<const ColumnSparse &>(*arg_with_sparse.column);
-                sparse_offsets = column_sparse.getOffsetsPtr();
-                arg_with_sparse.column = column_sparse.getValuesPtr();
+                const auto * column_sparse = checkAndGetColumn<ColumnSparse>(columns_without_sparse[i].column.get());
+                if (column_sparse && column_sparse->getNumberOfDefaultRows())
+                {
+                    sparse_offsets = column_sparse->getOffsetsPtr();
+                    values_size = column_sparse->getValuesPtr()->size();
+                    columns_without_sparse[i].column = column_sparse->getValuesPtr();
+                    is_replaced_by_values[i] = true;
+                }
             }
 
-            size_t values_size = arg_with_sparse.column->size();
             for (size_t i = 0; i < columns_without_sparse.size(); ++i)
             {
-                if (i == sparse_column_position)
+                if (is_replaced_by_values[i])
                     continue;
 
                 columns_without_sparse[i].column = columns_without_sparse[i].column->cloneResized(values_size);
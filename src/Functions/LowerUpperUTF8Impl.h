@@ -189,8 +189,40 @@ private:
         const auto v_not_case_upper_bound = _mm_set1_epi8(not_case_upper_bound + 1);
         const auto v_flip_case_mask = _mm_set1_epi8(flip_case_mask);
 
+        /// If we are before this position, we can still read at least 4 * bytes_sse.
+        const auto * src_end_sse4 = src_end - 4 * bytes_sse + 1;
+
         while (src < src_end_sse)
         {
+            /// Fast path: process 64 bytes at once while the data is pure ASCII,
+            /// which is the common case for mostly-ASCII columns. Checking a whole
+            /// cache line per iteration quarters the number of branches.
+            while (src < src_end_sse4)
+            {
+                const auto chars0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+                const auto chars1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + bytes_sse));
+                const auto chars2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 2 * bytes_sse));
+                const auto chars3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 3 * bytes_sse));
+
+                const auto non_ascii = _mm_or_si128(_mm_or_si128(chars0, chars1), _mm_or_si128(chars2, chars3));
+                if (_mm_movemask_epi8(_mm_cmplt_epi8(non_ascii, v_zero)) != 0)
+                    break;
+
+                for (auto chars : {chars0, chars1, chars2, chars3})
+                {
+                    const auto is_not_case
+                        = _mm_and_si128(_mm_cmpgt_epi8(chars, v_not_case_lower_bound), _mm_cmplt_epi8(chars, v_not_case_upper_bound));
+                    const auto xor_mask = _mm_and_si128(v_flip_case_mask, is_not_case);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_xor_si128(chars, xor_mask));
+
+                    src += bytes_sse;
+                    dst += bytes_sse;
+                }
+            }
+
+            if (src >= src_end_sse)
+                break;
+
             const auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
 
             /// check for ASCII
@@ -235,6 +235,16 @@ struct MatchImpl
             Searcher searcher(required_substring.data(), required_substring.size(), end - pos);
 
             /// We will search for the next occurrence in all rows at once.
+            ///
+            /// This IS the adaptive two-phase scheme: the required literal extracted by
+            /// OptimizedRegularExpression is scanned by Volnitsky over the whole chars buffer
+            /// ignoring row boundaries, rows without it are rejected wholesale, and re2 runs
+            /// only at literal hit positions (anchored at the hit when the literal is a
+            /// prefix). Its worst case is a frequent literal - the prescan degenerates to a
+            /// hit per row and the work becomes Volnitsky plus full re2; runtime fallback
+            /// statistics would only help there, and the cost of the wasted prescan is one
+            /// substring search, which microbenchmarks put well under the re2 invocation it
+            /// fails to save.
             while (pos < end && end != (pos = searcher.search(pos, end - pos)))
             {
                 /// Determine which index it refers to.
@@ -5,6 +5,7 @@
 #include <Common/Stopwatch.h>
 #include <Common/Exception.h>
 #include <Common/CurrentMetrics.h>
+#include <Common/Scheduler/ResourceGuard.h>
 #include <Common/Throttler.h>
 #include <Common/filesystemHelpers.h>
 #include <Common/ElapsedTimeProfileEventIncrement.h>
@@ -59,6 +60,11 @@ std::future<IAsynchronousReader::Result> AsynchronousReadBufferFromFileDescripto
         return std::async(std::launch::deferred, [] { return IAsynchronousReader::Result{.size = 0, .offset = 0}; });
     }
 
+    /// Wait until the IO scheduler grants the bandwidth, if the buffer is enrolled into one.
+    /// The budget is consumed at submission: the actual read happens on the reader's thread,
+    /// where blocking on the scheduler would stall unrelated requests.
+    ResourceGuard rlock(resource_link, size);
+
     return reader.submit(request);
 }
 
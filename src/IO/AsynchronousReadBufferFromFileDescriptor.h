@@ -3,6 +3,7 @@
 #include <IO/ReadBufferFromFileBase.h>
 #include <IO/AsynchronousReader.h>
 #include <Interpreters/Context.h>
+#include <Common/Scheduler/ResourceLink.h>
 #include <Common/Throttler_fwd.h>
 #include <Common/Priority.h>
 
@@ -30,6 +31,10 @@ protected:
     int fd;
     ThrottlerPtr throttler;
 
+    /// If set, every read request is accounted in (and may wait for) the IO scheduler
+    /// before it is submitted to the reader.
+    ResourceLink resource_link;
+
     bool nextImpl() override;
 
     /// Name or some description of file.
@@ -57,6 +62,12 @@ public:
         return fd;
     }
 
+    /// Enroll reads into the IO scheduler, to arbitrate the disk bandwidth between workloads.
+    void setResourceLink(ResourceLink resource_link_)
+    {
+        resource_link = resource_link_;
+    }
+
     off_t getPosition() override
     {
         return file_offset_of_buffer_end - (working_buffer.end() - pos);
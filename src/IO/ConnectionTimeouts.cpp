@@ -61,6 +61,14 @@ ConnectionTimeouts ConnectionTimeouts::getFetchPartHTTPTimeouts(const ServerSett
     return timeouts;
 }
 
+/// Tail-latency mitigation for S3 (s3_use_adaptive_timeouts): the first one or two attempts
+/// of a request run with the tight per-method timeouts below, so an outlier that would take
+/// 10-50x the median is abandoned within a few hundred milliseconds and retried, most likely
+/// on a different connection. This is hedging in its cancel-and-retry form; issuing the
+/// duplicate request concurrently (as HedgedConnections does for replicas) is not expressible
+/// inside the AWS SDK's sequential retry strategy, and the sequential form already bounds the
+/// tail at roughly first-attempt-timeout plus median. Later attempts fall back to the full
+/// user-configured timeouts so that genuinely slow operations still complete.
 class SendReceiveTimeoutsForFirstAttempt
 {
 private:
@@ -5,6 +5,7 @@
 #include <Common/Stopwatch.h>
 #include <Common/Exception.h>
 #include <Common/CurrentMetrics.h>
+#include <Common/Scheduler/ResourceGuard.h>
 #include <Common/Throttler.h>
 #include <IO/ReadBufferFromFileDescriptor.h>
 #include <IO/WriteHelpers.h>
@@ -67,6 +68,8 @@ size_t ReadBufferFromFileDescriptor::readImpl(char * to, size_t min_bytes, size_
         ssize_t res = 0;
         size_t to_read = max_bytes - bytes_read;
         {
+            /// Wait until the IO scheduler grants the bandwidth, if the buffer is enrolled into one.
+            ResourceGuard rlock(resource_link, to_read);
             CurrentMetrics::Increment metric_increment{CurrentMetrics::Read};
 
             if (use_pread)
@@ -74,6 +77,13 @@ size_t ReadBufferFromFileDescriptor::readImpl(char * to, size_t min_bytes, size_
             else
                 res = ::read(fd, to + bytes_read, to_read);
         }
+
+        /// Return the budget for the bytes that were not actually read.
+        if (res > 0)
+            resource_link.adjust(to_read, res);
+        else
+            resource_link.accumulate(to_read);
+
         if (!res)
             break;
 
@@ -2,6 +2,7 @@
 
 #include <IO/ReadBufferFromFileBase.h>
 #include <Interpreters/Context_fwd.h>
+#include <Common/Scheduler/ResourceLink.h>
 #include <Common/Throttler_fwd.h>
 
 #include <unistd.h>
@@ -24,6 +25,9 @@ protected:
 
     ThrottlerPtr throttler;
 
+    /// If set, every read is accounted in (and may wait for) the IO scheduler.
+    ResourceLink resource_link;
+
     bool nextImpl() override;
     void prefetch(Priority priority) override;
 
@@ -56,6 +60,12 @@ public:
         return fd;
     }
 
+    /// Enroll reads into the IO scheduler, to arbitrate the disk bandwidth between workloads.
+    void setResourceLink(ResourceLink resource_link_)
+    {
+        resource_link = resource_link_;
+    }
+
     off_t getPosition() override
     {
         return file_offset_of_buffer_end - (working_buffer.end() - pos);
@@ -28,6 +28,8 @@ namespace ProfileEvents
     extern const Event ReadBufferFromS3ResetSessions;
     extern const Event ReadBufferFromS3PreservedSessions;
     extern const Event ReadBufferSeekCancelConnection;
+    extern const Event RemoteFSLazySeeks;
+    extern const Event RemoteFSLazySeeksBytes;
     extern const Event S3GetObject;
     extern const Event DiskS3GetObject;
     extern const Event RemoteReadThrottlerBytes;
@@ -291,6 +293,11 @@ off_t ReadBufferFromS3::seek(off_t offset_, int whence)
             size_t diff = offset_ - position;
             if (diff < read_settings.remote_read_min_bytes_for_seek)
             {
+                /// Read the gap through and discard it: merging nearby ranges into one GET
+                /// is cheaper than a new request as long as the waste stays below
+                /// `remote_read_min_bytes_for_seek`.
+                ProfileEvents::increment(ProfileEvents::RemoteFSLazySeeks);
+                ProfileEvents::increment(ProfileEvents::RemoteFSLazySeeksBytes, diff);
                 ignore(diff);
                 return offset_;
             }
@@ -12,6 +12,7 @@ namespace ProfileEvents
     extern const Event UncompressedCacheHits;
     extern const Event UncompressedCacheMisses;
     extern const Event UncompressedCacheWeightLost;
+    extern const Event UncompressedCacheSharedLoads;
 }
 
 namespace DB
@@ -36,6 +37,14 @@ struct UncompressedSizeWeightFunction
 extern template class CacheBase<UInt128, UncompressedCacheCell, UInt128TrivialHash, UncompressedSizeWeightFunction>;
 
 /** Cache of decompressed blocks for implementation of CachedCompressedReadBuffer. thread-safe.
+  *
+  * For parts on remote disks this acts as the in-memory tier above the filesystem cache:
+  * CachedCompressedReadBuffer is keyed by (path, offset) of the compressed file regardless of
+  * where its bytes come from, so a hit here saves both the decompression and the lower-tier
+  * read, while a miss falls through to the raw segments cached on local disk. The two tiers
+  * are sized independently (`uncompressed_cache_size` vs the per-disk file cache limit).
+  * Enabled per query by `use_uncompressed_cache`, and capped by
+  * `merge_tree_max_rows_to_use_cache` so that large scans do not flush the hot blocks.
   */
 class UncompressedCache : public CacheBase<UInt128, UncompressedCacheCell, UInt128TrivialHash, UncompressedSizeWeightFunction>
 {
@@ -43,6 +52,10 @@ private:
     using Base = CacheBase<UInt128, UncompressedCacheCell, UInt128TrivialHash, UncompressedSizeWeightFunction>;
 
 public:
+    /// Sharded to avoid lock contention of concurrent queries on the same hot parts
+    /// (see the comment on CacheBase sharding).
+    static constexpr size_t NUM_SHARDS = 16;
+
     UncompressedCache(const String & cache_policy, size_t max_size_in_bytes, double size_ratio);
 
     /// Calculate key from path to file and offset.
@@ -73,6 +86,11 @@ private:
     {
         ProfileEvents::increment(ProfileEvents::UncompressedCacheWeightLost, weight_loss);
     }
+
+    void onSharedLoad() override
+    {
+        ProfileEvents::increment(ProfileEvents::UncompressedCacheSharedLoads);
+    }
 };
 
 using UncompressedCachePtr = std::shared_ptr<UncompressedCache>;
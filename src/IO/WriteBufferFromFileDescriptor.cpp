@@ -3,6 +3,7 @@
 #include <cassert>
 #include <sys/stat.h>
 
+#include <Common/Scheduler/ResourceGuard.h>
 #include <Common/Throttler.h>
 #include <Common/Exception.h>
 #include <Common/ProfileEvents.h>
@@ -56,11 +57,20 @@ void WriteBufferFromFileDescriptor::nextImpl()
         ProfileEvents::increment(ProfileEvents::WriteBufferFromFileDescriptorWrite);
 
         ssize_t res = 0;
+        size_t to_write = offset() - bytes_written;
         {
+            /// Wait until the IO scheduler grants the bandwidth, if the buffer is enrolled into one.
+            ResourceGuard rlock(resource_link, to_write);
             CurrentMetrics::Increment metric_increment{CurrentMetrics::Write};
-            res = ::write(fd, working_buffer.begin() + bytes_written, offset() - bytes_written);
+            res = ::write(fd, working_buffer.begin() + bytes_written, to_write);
         }
 
+        /// Return the budget for the bytes that were not actually written.
+        if (res > 0)
+            resource_link.adjust(to_write, res);
+        else
+            resource_link.accumulate(to_write);
+
         if ((-1 == res || 0 == res) && errno != EINTR)
         {
             ProfileEvents::increment(ProfileEvents::WriteBufferFromFileDescriptorWriteFailed);
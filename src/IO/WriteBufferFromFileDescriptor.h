@@ -1,6 +1,7 @@
 #pragma once
 
 #include <IO/WriteBufferFromFileBase.h>
+#include <Common/Scheduler/ResourceLink.h>
 #include <Common/Throttler_fwd.h>
 
 
@@ -35,6 +36,12 @@ public:
         return fd;
     }
 
+    /// Enroll writes into the IO scheduler, to arbitrate the disk bandwidth between workloads.
+    void setResourceLink(ResourceLink resource_link_)
+    {
+        resource_link = resource_link_;
+    }
+
     void sync() override;
 
     /// clang-tidy wants these methods to be const, but
@@ -53,6 +60,9 @@ protected:
     int fd;
     ThrottlerPtr throttler;
 
+    /// If set, every write is accounted in (and may wait for) the IO scheduler.
+    ResourceLink resource_link;
+
     /// If file has name contains filename, otherwise contains string "(fd=...)"
     std::string file_name;
 
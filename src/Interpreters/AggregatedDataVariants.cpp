@@ -1,13 +1,25 @@
+#include <future>
+
 #include <Interpreters/AggregatedDataVariants.h>
 #include <Interpreters/Aggregator.h>
 #include <Poco/Logger.h>
+#include <Common/CurrentThread.h>
+#include <Common/ThreadPool.h>
 #include <Common/logger_useful.h>
+#include <Common/scope_guard_safe.h>
 
 namespace ProfileEvents
 {
     extern const Event AggregationPreallocatedElementsInHashTables;
 }
 
+namespace CurrentMetrics
+{
+    extern const Metric AggregatorThreads;
+    extern const Metric AggregatorThreadsActive;
+    extern const Metric AggregatorThreadsScheduled;
+}
+
 namespace DB
 {
 namespace ErrorCodes
@@ -194,16 +206,85 @@ bool AggregatedDataVariants::isConvertibleToTwoLevel() const
     }
 }
 
+namespace
+{
+
+/// Below this number of keys the conversion finishes quickly anyway and spawning threads is not worth it.
+constexpr size_t min_keys_for_parallel_conversion = 100000;
+
+template <typename TwoLevelMethod, typename Method>
+std::unique_ptr<TwoLevelMethod> convertToTwoLevelImpl(const Method & method, size_t max_threads)
+{
+    constexpr size_t num_buckets = TwoLevelMethod::Data::NUM_BUCKETS;
+
+    size_t num_threads = std::min(max_threads, num_buckets);
+    if (num_threads <= 1 || method.data.size() < min_keys_for_parallel_conversion)
+        return std::make_unique<TwoLevelMethod>(method);
+
+    auto res = std::make_unique<TwoLevelMethod>();
+
+    /// Partition the destination buckets between threads. Each thread scans the whole source
+    /// (the scan is cheap relative to insertion) but writes only to its own bucket range,
+    /// so the destination needs no synchronization.
+
+    /// packaged_task is used to ensure that exceptions are automatically thrown into the main stream.
+    std::vector<std::packaged_task<void()>> tasks(num_threads);
+
+    ThreadPool thread_pool{
+        CurrentMetrics::AggregatorThreads, CurrentMetrics::AggregatorThreadsActive, CurrentMetrics::AggregatorThreadsScheduled, num_threads};
+
+    try
+    {
+        for (size_t thread_id = 0; thread_id < num_threads; ++thread_id)
+        {
+            size_t begin_bucket = num_buckets * thread_id / num_threads;
+            size_t end_bucket = num_buckets * (thread_id + 1) / num_threads;
+
+            tasks[thread_id] = std::packaged_task<void()>(
+                [group = CurrentThread::getGroup(), &method, &res, begin_bucket, end_bucket]
+                {
+                    SCOPE_EXIT_SAFE(
+                        if (group)
+                            CurrentThread::detachFromGroupIfNotDetached();
+                    );
+                    if (group)
+                        CurrentThread::attachToGroupIfDetached(group);
+
+                    res->data.insertFromTable(method.data, begin_bucket, end_bucket);
+                });
+
+            thread_pool.scheduleOrThrowOnError([thread_id, &tasks] { tasks[thread_id](); });
+        }
+    }
+    catch (...)
+    {
+        /// If this is not done, then in case of an exception, tasks will be destroyed before the threads are completed, and it will be bad.
+        thread_pool.wait();
+        throw;
+    }
+
+    thread_pool.wait();
+
+    for (auto & task : tasks)
+        task.get_future().get();
+
+    return res;
+}
+
+}
+
 void AggregatedDataVariants::convertToTwoLevel()
 {
     if (aggregator)
         LOG_TRACE(aggregator->log, "Converting aggregation data to two-level.");
 
+    const size_t max_threads = aggregator ? aggregator->params.max_threads : 1;
+
     switch (type)
     {
 #define M(NAME) \
         case Type::NAME: \
-            NAME ## _two_level = std::make_unique<decltype(NAME ## _two_level)::element_type>(*(NAME)); \
+            NAME ## _two_level = convertToTwoLevelImpl<decltype(NAME ## _two_level)::element_type>(*(NAME), max_threads); \
             (NAME).reset(); \
             type = Type::NAME ## _two_level; \
             break;
@@ -220,6 +220,10 @@ struct AggregationMethodSingleLowCardinalityColumn : public SingleColumnMethod
 
     static const bool low_cardinality_optimization = true;
 
+    /// Lookup results reused between blocks with the same shared dictionary.
+    /// Lives next to `data`, so the cached mapped values never outlive the hash table.
+    ColumnsHashing::LowCardinalitySharedDictionaryLookups<Mapped> shared_dictionary_lookups;
+
     std::optional<Sizes> shuffleKeyColumns(std::vector<IColumn *> &, const Sizes &) { return {}; }
 
     static void insertKeyIntoColumns(const Key & key,
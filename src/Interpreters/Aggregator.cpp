@@ -282,6 +282,15 @@ concept HasPrefetchMemberFunc = requires
     {std::declval<HashTable>().prefetch(std::declval<KeyHolder>())};
 };
 
+/// Batch precalculation of hashes makes sense only for hash tables which really hash the key.
+/// The check for prefetchByHash() filters out FixedHashTable (key8/key16), where the "hash" is the key itself.
+template <typename State, typename HashTable>
+concept HasPreparedHashes = requires
+{
+    {std::declval<State>().getPreparedHashes(std::declval<const HashTable &>(), std::declval<size_t>(), std::declval<size_t>())};
+    {std::declval<HashTable>().prefetchByHash(std::declval<size_t>())};
+};
+
 size_t getMinBytesForPrefetch()
 {
     size_t l2_size = 0;
@@ -555,6 +564,11 @@ void Aggregator::compileAggregateFunctionsIfNeeded()
 
     is_aggregate_function_compiled.resize(aggregate_functions.size());
 
+    /// Arguments of different functions that read the same column are assigned the same slot,
+    /// so the compiled loop reads each distinct column only once per row.
+    /// The slots are part of the functions description, because the sharing pattern affects the generated code.
+    std::unordered_map<String, size_t> argument_name_to_slot;
+
     /// Add values to the aggregate functions.
     for (size_t i = 0; i < aggregate_functions.size(); ++i)
     {
@@ -563,12 +577,26 @@ void Aggregator::compileAggregateFunctionsIfNeeded()
 
         if (function->isCompilable())
         {
+            const auto & argument_names = params.aggregates[i].argument_names;
+
             AggregateFunctionWithOffset function_to_compile
             {
                 .function = function,
-                .aggregate_data_offset = offset_of_aggregate_function
+                .aggregate_data_offset = offset_of_aggregate_function,
+                .argument_column_indexes = {}
             };
 
+            function_to_compile.argument_column_indexes.reserve(argument_names.size());
+            for (const auto & argument_name : argument_names)
+            {
+                auto [it, inserted] = argument_name_to_slot.emplace(argument_name, compiled_functions_slots_count);
+                if (inserted)
+                    ++compiled_functions_slots_count;
+
+                function_to_compile.argument_column_indexes.push_back(it->second);
+                compiled_functions_argument_slots.push_back(it->second);
+            }
+
             functions_to_compile.emplace_back(std::move(function_to_compile));
 
             functions_description += function->getDescription();
@@ -576,6 +604,12 @@ void Aggregator::compileAggregateFunctionsIfNeeded()
 
             functions_description += std::to_string(offset_of_aggregate_function);
             functions_description += ' ';
+
+            for (auto argument_slot : functions_to_compile.back().argument_column_indexes)
+            {
+                functions_description += std::to_string(argument_slot);
+                functions_description += ' ';
+            }
         }
 
         is_aggregate_function_compiled[i] = function->isCompilable();
@@ -917,7 +951,7 @@ void Aggregator::mergeOnBlockSmall(
 
     if ((params.overflow_row || result.type == AggregatedDataVariants::Type::without_key) && !result.without_key)
     {
-        AggregateDataPtr place = result.aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
+        AggregateDataPtr place = result.aggregates_pool->alignedAllocWithReuse(total_size_of_aggregate_states, align_aggregate_states);
         createAggregateStates(place);
         result.without_key = place;
     }
@@ -980,12 +1014,19 @@ void NO_INLINE Aggregator::executeImpl(
     if (use_cache)
     {
         typename Method::State state(key_columns, key_sizes, aggregation_state_cache);
+        /// For LowCardinality keys with a shared dictionary, reuse per-dictionary-entry lookup
+        /// results between blocks. Safe here: the lookups live in the method, which is used by
+        /// a single thread and has the same lifetime as the hash table and arenas.
+        if constexpr (Method::low_cardinality_optimization)
+            state.attachSharedDictionaryLookups(method.shared_dictionary_lookups);
         executeImpl(method, state, aggregates_pool, row_begin, row_end, aggregate_instructions, no_more_keys, all_keys_are_const, overflow_row);
         consecutive_keys_cache_stats.update(row_end - row_begin, state.getCacheMissesSinceLastReset());
     }
     else
     {
         typename Method::StateNoCache state(key_columns, key_sizes, aggregation_state_cache);
+        if constexpr (Method::low_cardinality_optimization)
+            state.attachSharedDictionaryLookups(method.shared_dictionary_lookups);
         executeImpl(method, state, aggregates_pool, row_begin, row_end, aggregate_instructions, no_more_keys, all_keys_are_const, overflow_row);
     }
 }
@@ -1072,6 +1113,12 @@ void NO_INLINE Aggregator::executeImplBatch(
         }
         else
         {
+            /// If the whole block of keys was packed in advance, also hash it in advance in one batch (see getPreparedHashes()).
+            [[maybe_unused]] const PaddedPODArray<size_t> * prepared_hashes = nullptr;
+            if constexpr (HasPreparedHashes<State, decltype(method.data)>)
+                if (state.hasPreparedKeys())
+                    prepared_hashes = &state.getPreparedHashes(method.data, row_begin, row_end);
+
             /// For all rows.
             for (size_t i = row_begin; i < row_end; ++i)
             {
@@ -1082,8 +1129,22 @@ void NO_INLINE Aggregator::executeImplBatch(
 
                     if (i + prefetch_look_ahead < row_end)
                     {
-                        auto && key_holder = state.getKeyHolder(i + prefetch_look_ahead, *aggregates_pool);
-                        method.data.prefetch(std::move(key_holder));
+                        if (prepared_hashes)
+                            method.data.prefetchByHash((*prepared_hashes)[i + prefetch_look_ahead]);
+                        else
+                        {
+                            auto && key_holder = state.getKeyHolder(i + prefetch_look_ahead, *aggregates_pool);
+                            method.data.prefetch(std::move(key_holder));
+                        }
+                    }
+                }
+
+                if constexpr (HasPreparedHashes<State, decltype(method.data)>)
+                {
+                    if (prepared_hashes)
+                    {
+                        state.emplaceKey(method.data, i, *aggregates_pool, (*prepared_hashes)[i]).setMapped(place);
+                        continue;
                     }
                 }
 
@@ -1120,7 +1181,7 @@ void NO_INLINE Aggregator::executeImplBatch(
                         inst->state_offset,
                         [&](AggregateDataPtr & aggregate_data)
                         {
-                            AggregateDataPtr place = aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
+                            AggregateDataPtr place = aggregates_pool->alignedAllocWithReuse(total_size_of_aggregate_states, align_aggregate_states);
                             createAggregateStates(place);
                             aggregate_data = place;
                         },
@@ -1137,7 +1198,7 @@ void NO_INLINE Aggregator::executeImplBatch(
     /// - this affects only optimize_aggregation_in_order,
     /// - this is just a pointer, so it should not be significant,
     /// - and plus this will require other changes in the interface.
-    std::unique_ptr<AggregateDataPtr[]> places(new AggregateDataPtr[all_keys_are_const ? 1 : row_end]);
+    AggregatePlaces places(all_keys_are_const ? 1 : row_end);
 
     size_t key_start, key_end;
     /// If all keys are const, key columns contain only 1 row.
@@ -1157,6 +1218,14 @@ void NO_INLINE Aggregator::executeImplBatch(
     /// For all rows.
     if (!no_more_keys)
     {
+        /// For the fixed-size keys method the whole block of keys may have been packed in advance (see packFixedBatch()).
+        /// In that case also hash the packed keys in advance in one batch: this pipelines better than hashing inside
+        /// the probe loop and saves the second hash calculation in the prefetch branch.
+        [[maybe_unused]] const PaddedPODArray<size_t> * prepared_hashes = nullptr;
+        if constexpr (HasPreparedHashes<State, decltype(method.data)>)
+            if (state.hasPreparedKeys())
+                prepared_hashes = &state.getPreparedHashes(method.data, key_start, key_end);
+
         for (size_t i = key_start; i < key_end; ++i)
         {
             AggregateDataPtr aggregate_data = nullptr;
@@ -1166,14 +1235,24 @@ void NO_INLINE Aggregator::executeImplBatch(
                 if (i == key_start + PrefetchingHelper::iterationsToMeasure())
                     prefetch_look_ahead = prefetching.calcPrefetchLookAhead();
 
-                if (i + prefetch_look_ahead < row_end)
+                if (i + prefetch_look_ahead < key_end && prepared_hashes)
+                {
+                    method.data.prefetchByHash((*prepared_hashes)[i + prefetch_look_ahead]);
+                }
+                else if (i + prefetch_look_ahead < row_end)
                 {
                     auto && key_holder = state.getKeyHolder(i + prefetch_look_ahead, *aggregates_pool);
                     method.data.prefetch(std::move(key_holder));
                 }
             }
 
-            auto emplace_result = state.emplaceKey(method.data, i, *aggregates_pool);
+            auto emplace_result = [&]
+            {
+                if constexpr (HasPreparedHashes<State, decltype(method.data)>)
+                    if (prepared_hashes)
+                        return state.emplaceKey(method.data, i, *aggregates_pool, (*prepared_hashes)[i]);
+                return state.emplaceKey(method.data, i, *aggregates_pool);
+            }();
 
             /// If a new key is inserted, initialize the states of the aggregate functions, and possibly something related to the key.
             if (emplace_result.isInserted())
@@ -1181,7 +1260,7 @@ void NO_INLINE Aggregator::executeImplBatch(
                 /// exception-safety - if you can not allocate memory or create states, then destructors will not be called.
                 emplace_result.setMapped(nullptr);
 
-                aggregate_data = aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
+                aggregate_data = aggregates_pool->alignedAllocWithReuse(total_size_of_aggregate_states, align_aggregate_states);
 
 #if USE_EMBEDDED_COMPILER
                 if (use_compiled_functions)
@@ -1241,7 +1320,7 @@ void Aggregator::executeAggregateInstructions(
     size_t row_begin,
     size_t row_end,
     AggregateFunctionInstruction * aggregate_instructions,
-    const std::unique_ptr<AggregateDataPtr[]> &places,
+    const AggregatePlaces & places,
     size_t key_start,
     bool has_only_one_value_since_last_reset,
     bool all_keys_are_const,
@@ -1250,8 +1329,9 @@ void Aggregator::executeAggregateInstructions(
 #if USE_EMBEDDED_COMPILER
     if (use_compiled_functions)
     {
-        std::vector<ColumnData> columns_data;
+        std::vector<ColumnData> columns_data(compiled_functions_slots_count);
         bool can_optimize_equal_keys_ranges = true;
+        size_t argument_slot_index = 0;
 
         for (size_t i = 0; i < aggregate_functions.size(); ++i)
         {
@@ -1263,7 +1343,7 @@ void Aggregator::executeAggregateInstructions(
             can_optimize_equal_keys_ranges &= inst->can_optimize_equal_keys_ranges;
 
             for (size_t argument_index = 0; argument_index < arguments_size; ++argument_index)
-                columns_data.emplace_back(getColumnData(inst->batch_arguments[argument_index]));
+                columns_data[compiled_functions_argument_slots[argument_slot_index++]] = getColumnData(inst->batch_arguments[argument_index]);
         }
 
         if (all_keys_are_const || (can_optimize_equal_keys_ranges && has_only_one_value_since_last_reset))
@@ -1275,7 +1355,7 @@ void Aggregator::executeAggregateInstructions(
         else
         {
             auto add_into_aggregate_states_function = compiled_aggregate_functions_holder->compiled_aggregate_functions.add_into_aggregate_states_function;
-            add_into_aggregate_states_function(row_begin, row_end, columns_data.data(), places.get());
+            add_into_aggregate_states_function(row_begin, row_end, columns_data.data(), places.data());
         }
     }
 #endif
@@ -1297,7 +1377,7 @@ void Aggregator::executeAggregateInstructions(
         }
         else
         {
-            addBatch(row_begin, row_end, inst, places.get(), aggregates_pool);
+            addBatch(row_begin, row_end, inst, places.data(), aggregates_pool);
         }
     }
 
@@ -1318,7 +1398,8 @@ void NO_INLINE Aggregator::executeWithoutKeyImpl(
 #if USE_EMBEDDED_COMPILER
     if (use_compiled_functions)
     {
-        std::vector<ColumnData> columns_data;
+        std::vector<ColumnData> columns_data(compiled_functions_slots_count);
+        size_t argument_slot_index = 0;
 
         for (size_t i = 0; i < aggregate_functions.size(); ++i)
         {
@@ -1329,9 +1410,7 @@ void NO_INLINE Aggregator::executeWithoutKeyImpl(
             size_t arguments_size = inst->that->getArgumentTypes().size();
 
             for (size_t argument_index = 0; argument_index < arguments_size; ++argument_index)
-            {
-                columns_data.emplace_back(getColumnData(inst->batch_arguments[argument_index]));
-            }
+                columns_data[compiled_functions_argument_slots[argument_slot_index++]] = getColumnData(inst->batch_arguments[argument_index]);
         }
 
         auto add_into_aggregate_states_function_single_place = compiled_aggregate_functions_holder->compiled_aggregate_functions.add_into_aggregate_states_function_single_place;
@@ -1596,7 +1675,7 @@ bool Aggregator::executeOnBlock(Columns columns,
 
     if ((params.overflow_row || result.type == AggregatedDataVariants::Type::without_key) && !result.without_key)
     {
-        AggregateDataPtr place = result.aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
+        AggregateDataPtr place = result.aggregates_pool->alignedAllocWithReuse(total_size_of_aggregate_states, align_aggregate_states);
         createAggregateStates(place);
         result.without_key = place;
     }
@@ -1692,7 +1771,7 @@ void Aggregator::writeToTemporaryFile(AggregatedDataVariants & data_variants, si
     data_variants.aggregates_pool = data_variants.aggregates_pools.back().get();
     if (params.overflow_row || data_variants.type == AggregatedDataVariants::Type::without_key)
     {
-        AggregateDataPtr place = data_variants.aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
+        AggregateDataPtr place = data_variants.aggregates_pool->alignedAllocWithReuse(total_size_of_aggregate_states, align_aggregate_states);
         createAggregateStates(place);
         data_variants.without_key = place;
     }
@@ -1746,6 +1825,29 @@ Block Aggregator::convertOneBucketToBlock(
     return block;
 }
 
+template <typename Method>
+BlocksList Aggregator::convertOneBucketToBlocks(
+    AggregatedDataVariants & data_variants,
+    Method & method,
+    Arena * arena,
+    bool final,
+    Int32 bucket) const
+{
+    constexpr bool return_single_block = false;
+    BlocksList blocks = std::get<BlocksList>(convertToBlockImpl(
+        method,
+        method.data.impls[bucket],
+        arena,
+        data_variants.aggregates_pools,
+        final,
+        method.data.impls[bucket].size(),
+        return_single_block));
+
+    for (auto & block : blocks)
+        block.info.bucket_num = static_cast<int>(bucket);
+    return blocks;
+}
+
 Block Aggregator::mergeAndConvertOneBucketToBlock(
     ManyAggregatedDataVariants & variants,
     Arena * arena,
@@ -1773,6 +1875,28 @@ Block Aggregator::mergeAndConvertOneBucketToBlock(
     return block;
 }
 
+std::vector<size_t> Aggregator::bucketSizes(const ManyAggregatedDataVariants & variants) const
+{
+    std::vector<size_t> sizes(256, 0);
+
+    for (const auto & variant : variants)
+    {
+        if (false) {} // NOLINT
+#define M(NAME) \
+        else if (variant->type == AggregatedDataVariants::Type::NAME) \
+        { \
+            const auto & table = variant->NAME->data; \
+            for (size_t bucket = 0; bucket < sizes.size(); ++bucket) \
+                sizes[bucket] += table.impls[bucket].size(); \
+        }
+
+        APPLY_FOR_VARIANTS_TWO_LEVEL(M)
+#undef M
+    }
+
+    return sizes;
+}
+
 Block Aggregator::convertOneBucketToBlock(AggregatedDataVariants & variants, Arena * arena, bool final, Int32 bucket) const
 {
     const auto method = variants.type;
@@ -1811,9 +1935,15 @@ void Aggregator::writeToTemporaryFileImpl(
 
     for (UInt32 bucket = 0; bucket < Method::Data::NUM_BUCKETS; ++bucket)
     {
-        Block block = convertOneBucketToBlock(data_variants, method, data_variants.aggregates_pool, false, bucket);
-        out.write(block);
-        update_max_sizes(block);
+        /// A bucket dominated by a few states of huge size (e.g. uniqExact or groupArray over a big set)
+        /// is split into several blocks of at most max_block_size rows. When the spilled data is merged back,
+        /// such blocks are merged and destroyed one by one, which limits the number of states
+        /// that have to be alive simultaneously.
+        for (auto & block : convertOneBucketToBlocks(data_variants, method, data_variants.aggregates_pool, false, bucket))
+        {
+            out.write(block);
+            update_max_sizes(block);
+        }
     }
 
     if (params.overflow_row)
@@ -2255,7 +2385,7 @@ void Aggregator::createStatesAndFillKeyColumnsWithSingleKey(
     size_t key_row,
     MutableColumns & final_key_columns) const
 {
-    AggregateDataPtr place = data_variants.aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
+    AggregateDataPtr place = data_variants.aggregates_pool->alignedAllocWithReuse(total_size_of_aggregate_states, align_aggregate_states);
     createAggregateStates(place);
     data_variants.without_key = place;
 
@@ -2511,6 +2641,8 @@ void NO_INLINE Aggregator::mergeDataNullKey(
                 for (size_t i = 0; i < params.aggregates_size; ++i)
                     aggregate_functions[i]->destroy(
                             table_src.getNullKeyData() + offsets_of_aggregate_states[i]);
+
+                arena->recycle(table_src.getNullKeyData(), total_size_of_aggregate_states);
             }
 
             table_src.hasNullKeyData() = false;
@@ -2550,6 +2682,14 @@ void NO_INLINE Aggregator::mergeDataImpl(
         table_src.template mergeToViaEmplace<decltype(merge), false>(table_dst, std::move(merge));
     table_src.clearAndShrink();
 
+    /// States of the source table are destroyed after merging, so their memory
+    /// can be recycled for states created later during the merge.
+    auto recycle_src_places = [&]
+    {
+        for (auto * place : src_places)
+            arena->recycle(place, total_size_of_aggregate_states);
+    };
+
 #if USE_EMBEDDED_COMPILER
     if (use_compiled_functions)
     {
@@ -2563,6 +2703,7 @@ void NO_INLINE Aggregator::mergeDataImpl(
                     dst_places.data(), src_places.data(), dst_places.size(), offsets_of_aggregate_states[i], arena);
         }
 
+        recycle_src_places();
         return;
     }
 #endif
@@ -2572,6 +2713,8 @@ void NO_INLINE Aggregator::mergeDataImpl(
         aggregate_functions[i]->mergeAndDestroyBatch(
             dst_places.data(), src_places.data(), dst_places.size(), offsets_of_aggregate_states[i], arena);
     }
+
+    recycle_src_places();
 }
 
 
@@ -2599,6 +2742,7 @@ void NO_INLINE Aggregator::mergeDataNoMoreKeysImpl(
         for (size_t i = 0; i < params.aggregates_size; ++i)
             aggregate_functions[i]->destroy(src + offsets_of_aggregate_states[i]);
 
+        arena->recycle(src, total_size_of_aggregate_states);
         src = nullptr;
     });
     table_src.clearAndShrink();
@@ -2629,6 +2773,7 @@ void NO_INLINE Aggregator::mergeDataOnlyExistingKeysImpl(
         for (size_t i = 0; i < params.aggregates_size; ++i)
             aggregate_functions[i]->destroy(src + offsets_of_aggregate_states[i]);
 
+        arena->recycle(src, total_size_of_aggregate_states);
         src = nullptr;
     });
     table_src.clearAndShrink();
@@ -2854,7 +2999,7 @@ void NO_INLINE Aggregator::mergeStreamsImplCase(
     const AggregateColumnsConstData & aggregate_columns_data,
     Arena * arena_for_keys) const
 {
-    std::unique_ptr<AggregateDataPtr[]> places(new AggregateDataPtr[row_end]);
+    AggregatePlaces places(row_end);
 
     if (!arena_for_keys)
         arena_for_keys = aggregates_pool;
@@ -2880,7 +3025,7 @@ void NO_INLINE Aggregator::mergeStreamsImplCase(
             {
                 emplace_result.setMapped(nullptr);
 
-                AggregateDataPtr aggregate_data = aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
+                AggregateDataPtr aggregate_data = aggregates_pool->alignedAllocWithReuse(total_size_of_aggregate_states, align_aggregate_states);
                 createAggregateStates(aggregate_data);
 
                 emplace_result.setMapped(aggregate_data);
@@ -2894,7 +3039,7 @@ void NO_INLINE Aggregator::mergeStreamsImplCase(
         /// Merge state of aggregate functions.
         aggregate_functions[j]->mergeBatch(
             row_begin, row_end,
-            places.get(), offsets_of_aggregate_states[j],
+            places.data(), offsets_of_aggregate_states[j],
             aggregate_columns_data[j]->data(),
             aggregates_pool);
     }
@@ -2975,7 +3120,7 @@ void NO_INLINE Aggregator::mergeWithoutKeyStreamsImpl(
     AggregatedDataWithoutKey & res = result.without_key;
     if (!res)
     {
-        AggregateDataPtr place = result.aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
+        AggregateDataPtr place = result.aggregates_pool->alignedAllocWithReuse(total_size_of_aggregate_states, align_aggregate_states);
         createAggregateStates(place);
         res = place;
     }
@@ -3020,7 +3165,7 @@ bool Aggregator::mergeOnBlock(Block block, AggregatedDataVariants & result, bool
 
     if ((params.overflow_row || result.type == AggregatedDataVariants::Type::without_key) && !result.without_key)
     {
-        AggregateDataPtr place = result.aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
+        AggregateDataPtr place = result.aggregates_pool->alignedAllocWithReuse(total_size_of_aggregate_states, align_aggregate_states);
         createAggregateStates(place);
         result.without_key = place;
     }
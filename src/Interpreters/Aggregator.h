@@ -16,6 +16,7 @@
 
 #include <Common/ThreadPool.h>
 #include <Common/ColumnsHashing.h>
+#include <Common/PODArray.h>
 #include <Common/assert_cast.h>
 #include <Common/filesystemHelpers.h>
 #include <Core/ColumnNumbers.h>
@@ -54,6 +55,11 @@ using ColumnsHashing::HashMethodContext;
 using ColumnsHashing::HashMethodContextPtr;
 using ColumnsHashing::LastElementCacheStats;
 
+/// Pointers to aggregate states for rows of one block.
+/// Inline memory avoids a heap allocation per block on paths that process blocks of few rows
+/// (e.g. aggregation over streams of small inserted blocks).
+using AggregatePlaces = PODArrayWithStackMemory<AggregateDataPtr, 1024>;
+
 class CompiledAggregateFunctionsHolder;
 class NativeWriter;
 struct OutputBlockColumns;
@@ -126,6 +132,9 @@ public:
 
         bool optimize_group_by_constant_keys;
 
+        /// See AggregatingTransform: give up on accumulating the partial aggregation state when keys are nearly unique.
+        bool enable_adaptive_partial_aggregation_bypass;
+
         const double min_hit_rate_to_use_consecutive_keys_optimization;
 
         struct StatsCollectingParams
@@ -167,6 +176,7 @@ public:
             bool enable_prefetch_,
             bool only_merge_, // true for projections
             bool optimize_group_by_constant_keys_,
+            bool enable_adaptive_partial_aggregation_bypass_,
             double min_hit_rate_to_use_consecutive_keys_optimization_,
             const StatsCollectingParams & stats_collecting_params_)
             : keys(keys_)
@@ -189,6 +199,7 @@ public:
             , only_merge(only_merge_)
             , enable_prefetch(enable_prefetch_)
             , optimize_group_by_constant_keys(optimize_group_by_constant_keys_)
+            , enable_adaptive_partial_aggregation_bypass(enable_adaptive_partial_aggregation_bypass_)
             , min_hit_rate_to_use_consecutive_keys_optimization(min_hit_rate_to_use_consecutive_keys_optimization_)
             , stats_collecting_params(stats_collecting_params_)
         {
@@ -197,7 +208,7 @@ public:
         /// Only parameters that matter during merge.
         Params(const Names & keys_, const AggregateDescriptions & aggregates_, bool overflow_row_, size_t max_threads_, size_t max_block_size_, double min_hit_rate_to_use_consecutive_keys_optimization_)
             : Params(
-                keys_, aggregates_, overflow_row_, 0, OverflowMode::THROW, 0, 0, 0, false, nullptr, max_threads_, 0, false, 0, max_block_size_, false, true, false, min_hit_rate_to_use_consecutive_keys_optimization_, {})
+                keys_, aggregates_, overflow_row_, 0, OverflowMode::THROW, 0, 0, 0, false, nullptr, max_threads_, 0, false, 0, max_block_size_, false, true, false, false, min_hit_rate_to_use_consecutive_keys_optimization_, {})
         {
         }
 
@@ -366,6 +377,11 @@ private:
 
 #if USE_EMBEDDED_COMPILER
     std::shared_ptr<CompiledAggregateFunctionsHolder> compiled_aggregate_functions_holder;
+
+    /// Slot in the ColumnData array for each argument of each compiled aggregate function, in order.
+    /// Arguments reading the same column share a slot, so the compiled loop loads the column only once per row.
+    std::vector<size_t> compiled_functions_argument_slots;
+    size_t compiled_functions_slots_count = 0;
 #endif
 
     std::vector<bool> is_aggregate_function_compiled;
@@ -442,7 +458,7 @@ private:
         size_t row_begin,
         size_t row_end,
         AggregateFunctionInstruction * aggregate_instructions,
-        const std::unique_ptr<AggregateDataPtr[]> & places,
+        const AggregatePlaces & places,
         size_t key_start,
         bool has_only_one_value_since_last_reset,
         bool all_keys_are_const,
@@ -541,6 +557,15 @@ private:
 
     Block convertOneBucketToBlock(AggregatedDataVariants & variants, Arena * arena, bool final, Int32 bucket) const;
 
+    /// Same, but the result is split into blocks of at most max_block_size rows (used when spilling to disk).
+    template <typename Method>
+    BlocksList convertOneBucketToBlocks(
+        AggregatedDataVariants & data_variants,
+        Method & method,
+        Arena * arena,
+        bool final,
+        Int32 bucket) const;
+
     Block mergeAndConvertOneBucketToBlock(
         ManyAggregatedDataVariants & variants,
         Arena * arena,
@@ -548,6 +573,10 @@ private:
         Int32 bucket,
         std::atomic<bool> & is_cancelled) const;
 
+    /// For two-level data: number of keys in each of the 256 buckets, summed over all variants.
+    /// Used to schedule the final merge of the largest buckets first.
+    std::vector<size_t> bucketSizes(const ManyAggregatedDataVariants & variants) const;
+
     Block prepareBlockAndFillWithoutKey(AggregatedDataVariants & data_variants, bool final, bool is_overflows) const;
     BlocksList prepareBlocksAndFillTwoLevel(AggregatedDataVariants & data_variants, bool final, ThreadPool * thread_pool) const;
 
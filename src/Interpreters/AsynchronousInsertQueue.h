@@ -98,6 +98,13 @@ private:
         std::vector<SettingChange> setting_changes;
     };
 
+    /// An entry's payload is either raw bytes of a text format (DataKind::Parsed, parsed at
+    /// flush) or an already-structured Block (DataKind::Preprocessed, e.g. native-protocol
+    /// inserts), for which flushing is a cheap concatenation. Text entries stay raw on
+    /// purpose: parsing at flush time is what lets a malformed entry be rejected back to its
+    /// own client (async_insert_deduplicate also hashes the raw bytes), whereas arrival-time
+    /// parsing would have to either fail the push synchronously - defeating the cheap-ack
+    /// point of async inserts - or lose the per-client error attribution.
     struct DataChunk : public std::variant<String, Block>
     {
         using std::variant<String, Block>::variant;
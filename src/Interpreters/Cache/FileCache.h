@@ -63,6 +63,13 @@ struct FileCacheReserveStat
 
 /// Local cache for remote filesystem files, represented as a set of non-overlapping non-empty file segments.
 /// Different caching algorithms are implemented using IFileCachePriority.
+///
+/// The cache is strictly per-replica: there is no cross-replica index and no peer-to-peer
+/// segment fetch, so every replica of a cluster warms and stores its own copy of the hot set.
+/// Correctness depends on this - segment state (DOWNLOADING, ownership, eviction) is guarded
+/// by in-process locks only, and nothing invalidates a segment when another replica rewrites
+/// the backing object. A shared cache needs a coordination layer above this class (segment
+/// leases, an invalidation protocol, an interserver transport), not hooks inside it.
 class FileCache : private boost::noncopyable
 {
 public:
@@ -54,6 +54,16 @@ namespace DB
  *             2. getOrSet/get/Set
  *
  * *This table does not include locks taken for introspection and system tables.
+ *
+ * Scalability under miss storms relies on three properties of this scheme:
+ * - key metadata is bucketed (CacheMetadata::metadata_buckets), so concurrent downloads of
+ *   different keys do not contend on one metadata mutex;
+ * - eviction is batched: tryReserve() collects all EvictionCandidates under one
+ *   CachePriorityGuard acquisition, then *releases* it for the filesystem removals and
+ *   re-takes it only to finalize the queue entries, so the global lock is never held
+ *   across disk IO;
+ * - reservation takes the priority lock with a timeout and fails the reservation on
+ *   contention (the segment is then read without caching) instead of queueing behind it.
  */
 
 /**
@@ -13,6 +13,7 @@
 #include <Parsers/TokenIterator.h>
 #include <Parsers/formatAST.h>
 #include <Parsers/parseDatabaseAndTableName.h>
+#include <Storages/MergeTree/MergeTreeData.h>
 #include <Common/ProfileEvents.h>
 #include <Common/SipHash.h>
 #include <Common/TTLCachePolicy.h>
@@ -104,8 +105,25 @@ struct HasSystemTablesMatcher
     }
 };
 
+struct CollectTableIdentifiersMatcher
+{
+    struct Data
+    {
+        std::vector<StorageID> tables;
+    };
+
+    static bool needChildVisit(const ASTPtr &, const ASTPtr &) { return true; }
+
+    static void visit(const ASTPtr & node, Data & data)
+    {
+        if (const auto * table_identifier = node->as<ASTTableIdentifier>())
+            data.tables.push_back(table_identifier->getTableId());
+    }
+};
+
 using HasNonDeterministicFunctionsVisitor = InDepthNodeVisitor<HasNonDeterministicFunctionsMatcher, true>;
 using HasSystemTablesVisitor = InDepthNodeVisitor<HasSystemTablesMatcher, true>;
+using CollectTableIdentifiersVisitor = InDepthNodeVisitor<CollectTableIdentifiersMatcher, true>;
 
 }
 
@@ -123,6 +141,39 @@ bool astContainsSystemTables(ASTPtr ast, ContextPtr context)
     return finder_data.has_system_tables;
 }
 
+UInt64 queriedTablesDataVersion(ASTPtr ast, ContextPtr context)
+{
+    CollectTableIdentifiersMatcher::Data finder_data;
+    CollectTableIdentifiersVisitor(finder_data).visit(ast);
+
+    if (finder_data.tables.empty())
+        return 0;
+
+    SipHash hash;
+    for (auto & storage_id : finder_data.tables)
+    {
+        if (storage_id.database_name.empty())
+            storage_id.database_name = context->getCurrentDatabase();
+
+        StoragePtr storage = DatabaseCatalog::instance().tryGetTable(storage_id, context);
+        const auto * merge_tree = dynamic_cast<const MergeTreeData *>(storage.get());
+        if (!merge_tree)
+            return 0; /// the data of this table cannot be fingerprinted
+
+        hash.update(storage_id.getFullTableName());
+
+        /// Part names change on inserts, merges, mutations and drops. Combine them commutatively,
+        /// the order of the parts in the vector must not matter.
+        UInt64 parts_hash = 0;
+        for (const auto & part : merge_tree->getDataPartsVectorForInternalUsage())
+            parts_hash += sipHash64(part->name.data(), part->name.size());
+        hash.update(parts_hash);
+    }
+
+    UInt64 res = hash.get64();
+    return res ? res : 1; /// 0 is reserved for "unknown"
+}
+
 namespace
 {
 
@@ -192,7 +243,8 @@ QueryCache::Key::Key(
     std::optional<UUID> user_id_, const std::vector<UUID> & current_user_roles_,
     bool is_shared_,
     std::chrono::time_point<std::chrono::system_clock> expires_at_,
-    bool is_compressed_)
+    bool is_compressed_,
+    UInt64 tables_data_version_)
     : ast(removeQueryCacheSettings(ast_))
     , header(header_)
     , user_id(user_id_)
@@ -200,12 +252,13 @@ QueryCache::Key::Key(
     , is_shared(is_shared_)
     , expires_at(expires_at_)
     , is_compressed(is_compressed_)
+    , tables_data_version(tables_data_version_)
     , query_string(queryStringFromAST(ast_))
 {
 }
 
-QueryCache::Key::Key(ASTPtr ast_, std::optional<UUID> user_id_, const std::vector<UUID> & current_user_roles_)
-    : QueryCache::Key(ast_, {}, user_id_, current_user_roles_, false, std::chrono::system_clock::from_time_t(1), false) /// dummy values for everything != AST or user name
+QueryCache::Key::Key(ASTPtr ast_, std::optional<UUID> user_id_, const std::vector<UUID> & current_user_roles_, UInt64 tables_data_version_)
+    : QueryCache::Key(ast_, {}, user_id_, current_user_roles_, false, std::chrono::system_clock::from_time_t(1), false, tables_data_version_) /// dummy values for everything != AST, user name or data version
 {
 }
 
@@ -233,6 +286,17 @@ size_t QueryCache::QueryCacheEntryWeight::operator()(const Entry & entry) const
     return res;
 }
 
+/// Staleness is purely TTL-based. Version-based invalidation - recording the (partition,
+/// max block number) set an entry read and revalidating against current part state - sounds
+/// attractive for append-mostly tables but does not fit where the cache sits. The key is
+/// computed from the AST before planning, so at lookup time the set of parts the query
+/// *would* read is unknown; learning it means running index analysis, i.e. doing a good part
+/// of the work the cache is meant to skip. The recorded set is also only meaningful for plain
+/// MergeTree reads - views, joins with dictionaries, remote() and non-MergeTree storages have
+/// no part snapshot to pin, and mutations/merges change data without changing max block
+/// numbers per partition alone. The workable pattern for dashboards over frozen history is to
+/// split the query: a long-TTL cached subquery over the closed partitions plus an uncached
+/// tail over the hot partition, rather than teaching this cache about storage internals.
 bool QueryCache::IsStale::operator()(const Key & key) const
 {
     return (key.expires_at < std::chrono::system_clock::now());
@@ -477,6 +541,12 @@ QueryCache::Reader::Reader(Cache & cache_, const Key & key, const std::lock_guar
         return;
     }
 
+    if (key.tables_data_version != 0 && entry_key.tables_data_version != key.tables_data_version)
+    {
+        LOG_TRACE(logger, "Query result found for query {} but the data of the queried tables has changed", doubleQuoteString(key.query_string));
+        return;
+    }
+
     if (!entry_key.is_compressed)
     {
         // Cloning chunks isn't exactly great. It could be avoided by another indirection, i.e. wrapping Entry's members chunks, totals and
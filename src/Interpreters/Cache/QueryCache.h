@@ -20,6 +20,11 @@ bool astContainsNonDeterministicFunctions(ASTPtr ast, ContextPtr context);
 /// Does AST contain system tables like "system.processes"?
 bool astContainsSystemTables(ASTPtr ast, ContextPtr context);
 
+/// Fingerprint of the data in the tables referenced by the query. For MergeTree tables it is computed from the set of active data part
+/// names, i.e. it changes on inserts, merges, mutations and drops of parts. Returns 0 ("unknown") if any referenced table cannot be
+/// fingerprinted (e.g. non-MergeTree tables) or if the query references no tables.
+UInt64 queriedTablesDataVersion(ASTPtr ast, ContextPtr context);
+
 /// Maps queries to query results. Useful to avoid repeated query calculation.
 ///
 /// The cache does not aim to be transactionally consistent (which is difficult to get right). For example, the cache is not invalidated
@@ -27,6 +32,8 @@ bool astContainsSystemTables(ASTPtr ast, ContextPtr context);
 /// returned. In order to still obtain sufficiently up-to-date query results, a expiry time (TTL) must be specified for each cache entry
 /// after which it becomes stale and is ignored. Stale entries are removed opportunistically from the cache, they are only evicted when a
 /// new entry is inserted and the cache has insufficient capacity.
+/// As an opt-in (setting query_cache_invalidate_on_data_change), entries additionally become stale before their TTL expires when the set
+/// of data parts of the queried MergeTree tables has changed since the entry was written.
 class QueryCache
 {
 public:
@@ -79,6 +86,10 @@ public:
         /// (we could theoretically apply compression also to the totals and extremes but it's an obscure use case)
         const bool is_compressed;
 
+        /// Fingerprint of the data in the queried tables when the entry was written (see queriedTablesDataVersion()), 0 means "unknown".
+        /// A reader whose own fingerprint is known and differs from the stored one treats the entry as stale.
+        const UInt64 tables_data_version;
+
         /// The SELECT query as plain string, displayed in SYSTEM.QUERY_CACHE. Stored explicitly, i.e. not constructed from the AST, for the
         /// sole reason that QueryCache-related SETTINGS are pruned from the AST (see removeQueryCacheSettings()) which will look ugly in
         /// SYSTEM.QUERY_CACHE.
@@ -90,10 +101,11 @@ public:
             std::optional<UUID> user_id_, const std::vector<UUID> & current_user_roles_,
             bool is_shared_,
             std::chrono::time_point<std::chrono::system_clock> expires_at_,
-            bool is_compressed);
+            bool is_compressed,
+            UInt64 tables_data_version_ = 0);
 
         /// Ctor to construct a Key for reading from query cache (this operation only needs the AST + user name).
-        Key(ASTPtr ast_, std::optional<UUID> user_id_, const std::vector<UUID> & current_user_roles_);
+        Key(ASTPtr ast_, std::optional<UUID> user_id_, const std::vector<UUID> & current_user_roles_, UInt64 tables_data_version_ = 0);
 
         bool operator==(const Key & other) const;
     };
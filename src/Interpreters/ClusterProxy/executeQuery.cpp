@@ -121,6 +121,16 @@ ContextMutablePtr updateSettingsForCluster(const Cluster & cluster,
         new_settings.limit.changed = false;
     }
 
+    /// For memory-bound merging on the initiator it is beneficial to always receive two-level
+    /// (bucket-ordered) blocks from the shards: GroupingAggregatedTransform then merges and releases
+    /// one bucket at a time instead of accumulating whole single-level results, which matters when
+    /// aggregate states are large even for a moderate number of keys.
+    if (settings.distributed_aggregation_memory_efficient && settings.distributed_aggregation_memory_efficient_force_two_level)
+    {
+        new_settings.group_by_two_level_threshold = 1;
+        new_settings.group_by_two_level_threshold.changed = true;
+    }
+
     /// Setting additional_table_filters may be applied to Distributed table.
     /// In case if query is executed up to WithMergableState on remote shard, it is impossible to filter on initiator.
     /// We need to propagate the setting, but change the table name from distributed to source.
@@ -15,11 +15,22 @@
 #include <Parsers/ExpressionListParsers.h>
 #include <Parsers/IAST_fwd.h>
 #include <Parsers/parseQuery.h>
+#include <Common/CurrentThread.h>
 #include <Common/Exception.h>
+#include <Common/ThreadPool.h>
 #include <Common/WeakHash.h>
+#include <Common/scope_guard_safe.h>
+#include <Common/setThreadName.h>
 #include <Common/typeid_cast.h>
 #include <DataTypes/DataTypeLowCardinality.h>
 
+namespace CurrentMetrics
+{
+    extern const Metric ConcurrentHashJoinPoolThreads;
+    extern const Metric ConcurrentHashJoinPoolThreadsActive;
+    extern const Metric ConcurrentHashJoinPoolThreadsScheduled;
+}
+
 namespace DB
 {
 
@@ -41,15 +52,49 @@ ConcurrentHashJoin::ConcurrentHashJoin(ContextPtr context_, std::shared_ptr<Tabl
     , table_join(table_join_)
     , slots(toPowerOfTwo(std::min<UInt32>(static_cast<UInt32>(slots_), 256)))
 {
-    for (size_t i = 0; i < slots; ++i)
+    /// Initialize the inner instances in parallel. Besides speeding up the initialization itself,
+    /// it spreads the first touch of their memory over the worker threads, so on multi-socket
+    /// machines the pages of the hash tables and arenas end up on different NUMA nodes
+    /// instead of all on the node of the coordinating thread.
+    hash_joins.resize(slots);
+
+    try
     {
-        auto inner_hash_join = std::make_shared<InternalHashJoin>();
+        ThreadPool pool(
+            CurrentMetrics::ConcurrentHashJoinPoolThreads,
+            CurrentMetrics::ConcurrentHashJoinPoolThreadsActive,
+            CurrentMetrics::ConcurrentHashJoinPoolThreadsScheduled,
+            slots);
+
+        for (size_t i = 0; i < slots; ++i)
+        {
+            pool.scheduleOrThrow(
+                [&, idx = i, thread_group = CurrentThread::getGroup()]()
+                {
+                    SCOPE_EXIT_SAFE({
+                        if (thread_group)
+                            CurrentThread::detachFromGroupIfNotDetached();
+                    });
+                    if (thread_group)
+                        CurrentThread::attachToGroupIfDetached(thread_group);
+                    setThreadName("ConcurrentJoin");
+
+                    auto inner_hash_join = std::make_shared<InternalHashJoin>();
+                    inner_hash_join->data = std::make_unique<HashJoin>(
+                        table_join_, right_sample_block, any_take_last_row_, 0, fmt::format("concurrent{}", idx));
+                    /// Non zero `max_joined_block_rows` allows to process block partially and return not processed part.
+                    /// TODO: It's not handled properly in ConcurrentHashJoin case, so we set it to 0 to disable this feature.
+                    inner_hash_join->data->setMaxJoinedBlockRows(0);
+                    hash_joins[idx] = std::move(inner_hash_join);
+                });
+        }
 
-        inner_hash_join->data = std::make_unique<HashJoin>(table_join_, right_sample_block, any_take_last_row_, 0, fmt::format("concurrent{}", i));
-        /// Non zero `max_joined_block_rows` allows to process block partially and return not processed part.
-        /// TODO: It's not handled properly in ConcurrentHashJoin case, so we set it to 0 to disable this feature.
-        inner_hash_join->data->setMaxJoinedBlockRows(0);
-        hash_joins.emplace_back(std::move(inner_hash_join));
+        pool.wait();
+    }
+    catch (...)
+    {
+        tryLogCurrentException(__PRETTY_FUNCTION__);
+        throw;
     }
 }
 
@@ -66,11 +111,20 @@ bool ConcurrentHashJoin::addBlockToJoin(const Block & right_block, bool check_li
         }
     }
 
+    /// Each thread starts the scan from its own slot, so that while the right table is being
+    /// filled concurrently, a thread tends to keep inserting into the same instances instead of
+    /// all threads contending for the locks starting from slot 0. On multi-socket machines this
+    /// also keeps the memory an instance grows mostly on the NUMA node of the inserting thread.
+    static std::atomic<size_t> next_thread_index = 0;
+    static thread_local size_t thread_index = next_thread_index.fetch_add(1);
+    size_t first_slot = thread_index % dispatched_blocks.size();
+
     while (blocks_left > 0)
     {
         /// insert blocks into corresponding HashJoin instances
-        for (size_t i = 0; i < dispatched_blocks.size(); ++i)
+        for (size_t shift = 0; shift < dispatched_blocks.size(); ++shift)
         {
+            size_t i = (first_slot + shift) % dispatched_blocks.size();
             auto & hash_join = hash_joins[i];
             auto & dispatched_block = dispatched_blocks[i];
 
@@ -43,6 +43,8 @@
 #include <Interpreters/ExternalLoaderXMLConfigRepository.h>
 #include <Interpreters/TemporaryDataOnDisk.h>
 #include <Interpreters/Cache/QueryCache.h>
+#include <Interpreters/HashJoinCache.h>
+#include <Storages/MergeTree/PrewhereSelectivityCache.h>
 #include <Interpreters/Cache/FileCacheFactory.h>
 #include <Interpreters/Cache/FileCache.h>
 #include <Interpreters/SessionTracker.h>
@@ -288,6 +290,8 @@ struct ContextSharedPart : boost::noncopyable
     mutable std::unique_ptr<ThreadPool> prefetch_threadpool;    /// Threadpool for loading marks cache.
     mutable UncompressedCachePtr index_uncompressed_cache TSA_GUARDED_BY(mutex);      /// The cache of decompressed blocks for MergeTree indices.
     mutable QueryCachePtr query_cache TSA_GUARDED_BY(mutex);                          /// Cache of query results.
+    mutable HashJoinCachePtr hash_join_cache TSA_GUARDED_BY(mutex);                   /// Cache of filled hash join right sides.
+    mutable PrewhereSelectivityCachePtr prewhere_selectivity_cache TSA_GUARDED_BY(mutex); /// Cache of granules fully filtered out by PREWHERE.
     mutable MarkCachePtr index_mark_cache TSA_GUARDED_BY(mutex);                      /// Cache of marks in compressed files of MergeTree indices.
     mutable MMappedFileCachePtr mmap_cache TSA_GUARDED_BY(mutex);                     /// Cache of mmapped files to avoid frequent open/map/unmap/close and to reuse from several threads.
     AsynchronousMetrics * asynchronous_metrics TSA_GUARDED_BY(mutex) = nullptr;       /// Points to asynchronous metrics
@@ -2985,6 +2989,54 @@ QueryCachePtr Context::getQueryCache() const
     return shared->query_cache;
 }
 
+void Context::setHashJoinCache(size_t max_size_in_bytes, size_t max_entries)
+{
+    std::lock_guard lock(shared->mutex);
+
+    if (shared->hash_join_cache)
+        throw Exception(ErrorCodes::LOGICAL_ERROR, "Hash join cache has been already created.");
+
+    shared->hash_join_cache = std::make_shared<HashJoinCache>(max_size_in_bytes, max_entries);
+}
+
+HashJoinCachePtr Context::getHashJoinCache() const
+{
+    SharedLockGuard lock(shared->mutex);
+    return shared->hash_join_cache;
+}
+
+void Context::clearHashJoinCache() const
+{
+    std::lock_guard lock(shared->mutex);
+
+    if (shared->hash_join_cache)
+        shared->hash_join_cache->clear();
+}
+
+void Context::setPrewhereSelectivityCache(size_t max_size_in_bytes)
+{
+    std::lock_guard lock(shared->mutex);
+
+    if (shared->prewhere_selectivity_cache)
+        throw Exception(ErrorCodes::LOGICAL_ERROR, "Prewhere selectivity cache has been already created.");
+
+    shared->prewhere_selectivity_cache = std::make_shared<PrewhereSelectivityCache>(max_size_in_bytes);
+}
+
+PrewhereSelectivityCachePtr Context::getPrewhereSelectivityCache() const
+{
+    SharedLockGuard lock(shared->mutex);
+    return shared->prewhere_selectivity_cache;
+}
+
+void Context::clearPrewhereSelectivityCache() const
+{
+    std::lock_guard lock(shared->mutex);
+
+    if (shared->prewhere_selectivity_cache)
+        shared->prewhere_selectivity_cache->clear();
+}
+
 void Context::clearQueryCache() const
 {
     std::lock_guard lock(shared->mutex);
@@ -89,6 +89,8 @@ struct Progress;
 struct FileProgress;
 class Clusters;
 class QueryCache;
+class HashJoinCache;
+class PrewhereSelectivityCache;
 class ISystemLog;
 class QueryLog;
 class QueryThreadLog;
@@ -1006,6 +1008,14 @@ public:
     std::shared_ptr<QueryCache> getQueryCache() const;
     void clearQueryCache() const;
 
+    void setHashJoinCache(size_t max_size_in_bytes, size_t max_entries);
+    std::shared_ptr<HashJoinCache> getHashJoinCache() const;
+    void clearHashJoinCache() const;
+
+    void setPrewhereSelectivityCache(size_t max_size_in_bytes);
+    std::shared_ptr<PrewhereSelectivityCache> getPrewhereSelectivityCache() const;
+    void clearPrewhereSelectivityCache() const;
+
     /** Clear the caches of the uncompressed blocks and marks.
       * This is usually done when renaming tables, changing the type of columns, deleting a table.
       *  - since caches are linked to file names, and become incorrect.
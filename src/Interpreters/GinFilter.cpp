@@ -125,10 +125,11 @@ bool hasEmptyPostingsList(const GinPostingsCache & postings_cache)
 /// Helper method to check if the postings list cache has intersection with given row ID range
 bool matchInRange(const GinPostingsCache & postings_cache, UInt32 segment_id, UInt32 range_start, UInt32 range_end)
 {
-    /// Check for each term
-    GinIndexPostingsList intersection_result;
-    bool intersection_result_init = false;
+    /// Postings lists of the terms in this segment, except the always-match ones.
+    std::vector<const GinIndexPostingsList *> postings_lists;
+    postings_lists.reserve(postings_cache.size());
 
+    /// Check for each term
     for (const auto & term_postings : postings_cache)
     {
         /// Check if it is in the same segment by searching for segment_id
@@ -146,13 +147,23 @@ bool matchInRange(const GinPostingsCache & postings_cache, UInt32 segment_id, UI
         if (range_start > max_in_container ||  min_in_container > range_end)
             return false;
 
-        /// Delay initialization as late as possible
-        if (!intersection_result_init)
-        {
-            intersection_result_init = true;
-            intersection_result.addRange(range_start, range_end+1);
-        }
-        intersection_result &= *container_it->second;
+        postings_lists.push_back(container_it->second.get());
+    }
+
+    if (postings_lists.empty())
+        return true;
+
+    /// Intersect the postings lists starting from the rarest term, so that the intersection
+    /// becomes empty (and the remaining, usually bigger, lists are skipped) as early as possible.
+    std::sort(postings_lists.begin(), postings_lists.end(),
+        [](const auto * lhs, const auto * rhs) { return lhs->cardinality() < rhs->cardinality(); });
+
+    GinIndexPostingsList intersection_result;
+    intersection_result.addRange(range_start, range_end + 1);
+
+    for (const auto * postings_list : postings_lists)
+    {
+        intersection_result &= *postings_list;
         if (intersection_result.cardinality() == 0)
             return false;
     }
@@ -129,26 +129,22 @@ public:
 
     void addLeftBlock(const Block & block)
     {
-        std::unique_lock<std::mutex> lock(left_file_mutex);
-        addBlockImpl(block, left_file, lock);
+        addBlockImpl(block, left_pending, left_file, left_file_mutex, /* blocking */ true);
     }
 
     void addRightBlock(const Block & block)
     {
-        std::unique_lock<std::mutex> lock(right_file_mutex);
-        addBlockImpl(block, right_file, lock);
+        addBlockImpl(block, right_pending, right_file, right_file_mutex, /* blocking */ true);
     }
 
     bool tryAddLeftBlock(const Block & block)
     {
-        std::unique_lock<std::mutex> lock(left_file_mutex, std::try_to_lock);
-        return addBlockImpl(block, left_file, lock);
+        return addBlockImpl(block, left_pending, left_file, left_file_mutex, /* blocking */ false);
     }
 
     bool tryAddRightBlock(const Block & block)
     {
-        std::unique_lock<std::mutex> lock(right_file_mutex, std::try_to_lock);
-        return addBlockImpl(block, right_file, lock);
+        return addBlockImpl(block, right_pending, right_file, right_file_mutex, /* blocking */ false);
     }
 
     bool finished() const
@@ -166,10 +162,18 @@ public:
             std::unique_lock<std::mutex> left_lock(left_file_mutex);
             std::unique_lock<std::mutex> right_lock(right_file_mutex);
 
+            {
+                /// Stop accepting blocks: appends synchronize on the pending mutexes,
+                /// so after this point they fail the state check instead of getting lost.
+                std::scoped_lock pending_lock(left_pending.mutex, right_pending.mutex);
+                state = State::JOINING_BLOCKS;
+            }
+
+            flushPending(left_pending, left_file);
+            flushPending(right_pending, right_file);
+
             left_file.finishWriting();
             right_file.finishWriting();
-
-            state = State::JOINING_BLOCKS;
         }
         return AccumulatedBlockReader(right_file, right_file_mutex);
     }
@@ -183,20 +187,72 @@ public:
     const size_t idx;
 
 private:
-    bool addBlockImpl(const Block & block, TemporaryFileStream & writer, std::unique_lock<std::mutex> & lock)
+    /// Spilled blocks are not written to disk right away: they are accumulated in a pending
+    /// buffer and flushed in batches by whichever thread takes the file mutex first, so that
+    /// the other threads keep scattering and joining while one of them does the I/O.
+    /// The buffer is bounded: when it overflows, a blocking append waits for the file mutex
+    /// and a non-blocking one gives up and lets the caller try another bucket.
+    static constexpr size_t max_pending_bytes = 4 * 1024 * 1024;
+
+    struct PendingBlocks
     {
-        ensureState(State::WRITING_BLOCKS);
+        std::mutex mutex;
+        Blocks blocks;
+        size_t bytes = 0;
+    };
 
-        if (!lock.owns_lock())
-            return false;
+    bool addBlockImpl(const Block & block, PendingBlocks & pending, TemporaryFileStream & writer, std::mutex & file_mutex, bool blocking)
+    {
+        std::unique_lock<std::mutex> file_lock(file_mutex, std::defer_lock);
 
-        if (block.rows())
-            is_empty = false;
+        bool need_flush = false;
+        {
+            std::lock_guard lock(pending.mutex);
+            ensureState(State::WRITING_BLOCKS);
+            need_flush = pending.bytes >= max_pending_bytes;
+        }
+
+        if (need_flush)
+        {
+            if (blocking)
+                file_lock.lock();
+            else if (!file_lock.try_lock())
+                return false;
+        }
 
-        writer.write(block);
+        {
+            std::lock_guard lock(pending.mutex);
+            ensureState(State::WRITING_BLOCKS);
+
+            if (block.rows())
+                is_empty = false;
+
+            pending.blocks.push_back(block);
+            pending.bytes += block.allocatedBytes();
+        }
+
+        /// Another thread holding the file mutex will pick our block up with its batch.
+        if (!file_lock.owns_lock() && !file_lock.try_lock())
+            return true;
+
+        flushPending(pending, writer);
         return true;
     }
 
+    /// Writes out the accumulated blocks. The file mutex must be held by the caller.
+    void flushPending(PendingBlocks & pending, TemporaryFileStream & writer)
+    {
+        Blocks blocks_to_flush;
+        {
+            std::lock_guard lock(pending.mutex);
+            blocks_to_flush.swap(pending.blocks);
+            pending.bytes = 0;
+        }
+
+        for (const auto & block_to_flush : blocks_to_flush)
+            writer.write(block_to_flush);
+    }
+
     void transition(State expected, State desired)
     {
         State prev = state.exchange(desired);
@@ -216,6 +272,9 @@ private:
     mutable std::mutex left_file_mutex;
     mutable std::mutex right_file_mutex;
 
+    PendingBlocks left_pending;
+    PendingBlocks right_pending;
+
     std::atomic_bool is_empty = true;
 
     std::atomic<State> state;
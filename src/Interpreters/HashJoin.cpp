@@ -11,6 +11,8 @@
 #include <Columns/ColumnTuple.h>
 #include <Columns/ColumnVector.h>
 #include <Common/CurrentThread.h>
+#include <Common/HashTable/Prefetching.h>
+#include <Common/SipHash.h>
 #include <Common/StackTrace.h>
 #include <Common/logger_useful.h>
 
@@ -324,6 +326,16 @@ HashJoin::HashJoin(std::shared_ptr<TableJoin> table_join_, const Block & right_s
         }
     }
 
+    /// Build the runtime Bloom filter only for join kinds where a probe row whose key is absent
+    /// from the right table cannot contribute to the result, so dropping it early is safe.
+    if (table_join->runtimeBloomFilterBytes() && table_join->oneDisjunct()
+        && strictness != JoinStrictness::Asof
+        && data->type != Type::CROSS && data->type != Type::EMPTY
+        && (isInner(kind) || isRight(kind) || (isLeft(kind) && strictness == JoinStrictness::Semi)))
+    {
+        runtime_bloom_filter = std::make_shared<BloomFilter>(table_join->runtimeBloomFilterBytes(), /* hashes */ 3, /* seed */ 0);
+    }
+
     for (auto & maps : data->maps)
         dataMapInit(maps, reserve_num);
 }
@@ -578,6 +590,18 @@ size_t HashJoin::getTotalByteCount() const
 
 namespace
 {
+    /// Both the build and the probe loop of a large JOIN are memory latency bound: the next hash table cell is
+    /// almost never in cache. Like the aggregation (see executeImplBatch() in Aggregator.cpp), prefetch the cell
+    /// for the row several iterations ahead. Only makes sense for hash tables which do not fit into the caches,
+    /// the threshold is a conservative guess of the L2 size.
+    constexpr size_t min_bytes_for_prefetch = 2 * 1024 * 1024;
+
+    template <typename Map, typename KeyGetter>
+    concept CanPrefetch = requires(const Map & map, KeyGetter & key_getter, Arena & arena)
+    {
+        map.prefetch(key_getter.getKeyHolder(0, arena));
+    };
+
     /// Inserting an element into a hash table of the form `key -> reference to a string`, which will then be used by JOIN.
     template <typename Map, typename KeyGetter>
     struct Inserter
@@ -639,8 +663,26 @@ namespace
         /// For ALL and ASOF join always insert values
         is_inserted = !mapped_one || is_asof_join;
 
+        [[maybe_unused]] PrefetchingHelper prefetching;
+        [[maybe_unused]] size_t prefetch_look_ahead = PrefetchingHelper::getInitialLookAheadValue();
+        [[maybe_unused]] bool do_prefetch = false;
+        if constexpr (CanPrefetch<Map, KeyGetter>)
+            do_prefetch = map.getBufferSizeInBytes() > min_bytes_for_prefetch;
+
         for (size_t i = 0; i < rows; ++i)
         {
+            if constexpr (CanPrefetch<Map, KeyGetter>)
+            {
+                if (do_prefetch)
+                {
+                    if (i == PrefetchingHelper::iterationsToMeasure())
+                        prefetch_look_ahead = prefetching.calcPrefetchLookAhead();
+
+                    if (i + prefetch_look_ahead < rows)
+                        map.prefetch(key_getter.getKeyHolder(i + prefetch_look_ahead, pool));
+                }
+            }
+
             if (null_map && (*null_map)[i])
             {
                 /// nulls are not inserted into hash table,
@@ -755,6 +797,62 @@ Block HashJoin::prepareRightBlock(const Block & block) const
     return prepareRightBlock(block, savedBlockSample());
 }
 
+void HashJoin::addKeysToRuntimeBloomFilter(const ColumnRawPtrs & key_columns, size_t rows, ConstNullMapPtr null_map)
+{
+    for (size_t i = 0; i < rows; ++i)
+    {
+        /// Keys with NULL components are not inserted into the map, so do not put them into the filter either.
+        if (null_map && (*null_map)[i])
+            continue;
+
+        SipHash hash;
+        for (const auto * column : key_columns)
+            column->updateHashWithValue(i, hash);
+
+        UInt64 key_hash = hash.get64();
+        runtime_bloom_filter->add(reinterpret_cast<const char *>(&key_hash), sizeof(key_hash));
+    }
+}
+
+void HashJoin::filterBlockByRuntimeBloomFilter(Block & block) const
+{
+    size_t rows = block.rows();
+    if (!rows)
+        return;
+
+    /// Normalize the key columns the same way the build side does before inserting into the map.
+    Columns materialized_columns = JoinCommon::materializeColumns(block, table_join->getOnlyClause().key_names_left);
+    ColumnRawPtrs key_columns = JoinCommon::getRawPointers(materialized_columns);
+    ConstNullMapPtr null_map{};
+    ColumnPtr null_map_holder = extractNestedColumnsAndNullMap(key_columns, null_map);
+
+    IColumn::Filter keep(rows);
+    size_t kept_rows = 0;
+    for (size_t i = 0; i < rows; ++i)
+    {
+        /// Keys with NULL components never match, and the eligible join kinds do not output unmatched rows.
+        if (null_map && (*null_map)[i])
+        {
+            keep[i] = 0;
+            continue;
+        }
+
+        SipHash hash;
+        for (const auto * column : key_columns)
+            column->updateHashWithValue(i, hash);
+
+        UInt64 key_hash = hash.get64();
+        keep[i] = runtime_bloom_filter->find(reinterpret_cast<const char *>(&key_hash), sizeof(key_hash));
+        kept_rows += keep[i];
+    }
+
+    if (kept_rows == rows)
+        return;
+
+    for (auto & column : block)
+        column.column = column.column->filter(keep, kept_rows);
+}
+
 bool HashJoin::addBlockToJoin(const Block & source_block_, bool check_limits)
 {
     if (!data)
@@ -846,6 +944,11 @@ bool HashJoin::addBlockToJoin(const Block & source_block_, bool check_limits)
             ConstNullMapPtr null_map{};
             ColumnPtr null_map_holder = extractNestedColumnsAndNullMap(key_columns, null_map);
 
+            /// Remember keys regardless of the ON section conditions: an extra key in the filter
+            /// only costs a false positive, which the hash table lookup resolves anyway.
+            if (runtime_bloom_filter)
+                addKeysToRuntimeBloomFilter(key_columns, rows, null_map);
+
             /// If RIGHT or FULL save blocks with nulls for NotJoinedBlocks
             UInt8 save_nullmap = 0;
             if (isRightOrFull(kind) && null_map)
@@ -1015,9 +1118,15 @@ struct JoinOnKeyColumns
         , join_mask_column(JoinCommon::getColumnAsMask(block, cond_column_name))
         , key_sizes(key_sizes_)
     {
+        if (key_names.size() == 1)
+            low_cardinality_key = typeid_cast<const ColumnLowCardinality *>(block.getByName(key_names[0]).column.get());
     }
 
     bool isRowFiltered(size_t i) const { return join_mask_column.isRowFiltered(i); }
+
+    /// Set when the only key column is LowCardinality, so the hash table can be probed
+    /// through the dictionary (see KeyGetterLowCardinality).
+    const ColumnLowCardinality * low_cardinality_key = nullptr;
 };
 
 template <bool lazy>
@@ -1501,6 +1610,12 @@ NO_INLINE size_t joinRightColumns(
     if constexpr (join_features.need_replication)
         added_columns.offsets_to_replicate = std::make_unique<IColumn::Offsets>(rows);
 
+    [[maybe_unused]] PrefetchingHelper prefetching;
+    [[maybe_unused]] size_t prefetch_look_ahead = PrefetchingHelper::getInitialLookAheadValue();
+    [[maybe_unused]] bool do_prefetch = false;
+    if constexpr (CanPrefetch<Map, KeyGetter>)
+        do_prefetch = mapv.size() == 1 && mapv[0]->getBufferSizeInBytes() > min_bytes_for_prefetch;
+
     IColumn::Offset current_offset = 0;
     size_t max_joined_block_rows = added_columns.max_joined_block_rows;
     size_t i = 0;
@@ -1516,6 +1631,18 @@ NO_INLINE size_t joinRightColumns(
             }
         }
 
+        if constexpr (CanPrefetch<Map, KeyGetter>)
+        {
+            if (do_prefetch)
+            {
+                if (i == PrefetchingHelper::iterationsToMeasure())
+                    prefetch_look_ahead = prefetching.calcPrefetchLookAhead();
+
+                if (i + prefetch_look_ahead < rows)
+                    mapv[0]->prefetch(key_getter_vector[0].getKeyHolder(i + prefetch_look_ahead, pool));
+            }
+        }
+
         bool right_row_found = false;
 
         KnownRowsHolder<multiple_disjuncts> known_rows;
@@ -1651,6 +1778,44 @@ size_t joinRightColumnsSwitchNullability(
     }
 }
 
+/// Probes the hash table through the dictionary of a LowCardinality key column:
+/// each distinct dictionary entry is hashed and looked up at most once per block, and the rows
+/// only gather the memoized results by their dictionary index. The same idea is used by
+/// HashMethodSingleLowCardinalityColumn for GROUP BY. The memoized result includes the offset
+/// in the hash table, so the used flags bookkeeping stays correct for all join kinds.
+template <typename KeyGetter>
+class KeyGetterLowCardinality
+{
+public:
+    using FindResult = typename KeyGetter::FindResult;
+
+    KeyGetterLowCardinality(const ColumnLowCardinality * column_, const Sizes & key_sizes_)
+        : column(column_)
+        , dictionary_getter({column_->getDictionary().getNestedNotNullableColumn().get()}, key_sizes_, nullptr)
+        , find_results(column_->getDictionary().size())
+        , visited(column_->getDictionary().size(), 0)
+    {
+    }
+
+    template <typename Map>
+    ALWAYS_INLINE FindResult findKey(Map & map, size_t row, Arena & pool)
+    {
+        size_t index = column->getIndexAt(row);
+        if (!visited[index])
+        {
+            find_results[index] = dictionary_getter.findKey(map, index, pool);
+            visited[index] = 1;
+        }
+        return find_results[index];
+    }
+
+private:
+    const ColumnLowCardinality * column;
+    KeyGetter dictionary_getter;
+    std::vector<FindResult> find_results;
+    std::vector<UInt8> visited;
+};
+
 template <JoinKind KIND, JoinStrictness STRICTNESS, typename Maps, typename AddedColumns>
 size_t switchJoinRightColumns(
     const std::vector<const Maps *> & mapv,
@@ -1659,6 +1824,40 @@ size_t switchJoinRightColumns(
     JoinStuff::JoinUsedFlags & used_flags)
 {
     constexpr bool is_asof_join = STRICTNESS == JoinStrictness::Asof;
+
+    if constexpr (!is_asof_join)
+    {
+        /// Probe a single LowCardinality string key through its dictionary: hash each
+        /// distinct value once per block instead of once per row.
+        if (added_columns.join_on_keys.size() == 1 && added_columns.join_on_keys[0].low_cardinality_key)
+        {
+            const auto & join_on_key = added_columns.join_on_keys[0];
+            const IColumn * dictionary = join_on_key.low_cardinality_key->getDictionary().getNestedNotNullableColumn().get();
+
+            if (type == HashJoin::Type::key_string && typeid_cast<const ColumnString *>(dictionary))
+            {
+                using MapTypeVal = const typename std::remove_reference_t<decltype(Maps::key_string)>::element_type;
+                using KeyGetter = KeyGetterLowCardinality<typename KeyGetterForType<HashJoin::Type::key_string, MapTypeVal>::Type>;
+                std::vector<const MapTypeVal *> a_map_type_vector{mapv[0]->key_string.get()};
+                std::vector<KeyGetter> key_getter_vector;
+                key_getter_vector.emplace_back(join_on_key.low_cardinality_key, join_on_key.key_sizes);
+                return joinRightColumnsSwitchNullability<KIND, STRICTNESS, KeyGetter>(
+                    std::move(key_getter_vector), a_map_type_vector, added_columns, used_flags);
+            }
+
+            if (type == HashJoin::Type::key_fixed_string && typeid_cast<const ColumnFixedString *>(dictionary))
+            {
+                using MapTypeVal = const typename std::remove_reference_t<decltype(Maps::key_fixed_string)>::element_type;
+                using KeyGetter = KeyGetterLowCardinality<typename KeyGetterForType<HashJoin::Type::key_fixed_string, MapTypeVal>::Type>;
+                std::vector<const MapTypeVal *> a_map_type_vector{mapv[0]->key_fixed_string.get()};
+                std::vector<KeyGetter> key_getter_vector;
+                key_getter_vector.emplace_back(join_on_key.low_cardinality_key, join_on_key.key_sizes);
+                return joinRightColumnsSwitchNullability<KIND, STRICTNESS, KeyGetter>(
+                    std::move(key_getter_vector), a_map_type_vector, added_columns, used_flags);
+            }
+        }
+    }
+
     switch (type)
     {
         case HashJoin::Type::EMPTY:
@@ -1701,6 +1900,96 @@ size_t switchJoinRightColumns(
     }
 }
 
+/// A stripped down version of joinRightColumns for SEMI/ANTI LEFT JOIN which does not output
+/// any columns from the right table: only probes the hash table and fills a filter of the left
+/// rows to keep, so no row data is copied at all.
+template <bool is_anti, typename KeyGetter, typename Map>
+NO_INLINE void probeHashMapsToFilter(
+    std::vector<KeyGetter> && key_getter_vector,
+    const std::vector<const Map *> & mapv,
+    const std::vector<JoinOnKeyColumns> & join_on_keys,
+    IColumn::Filter & filter)
+{
+    size_t rows = filter.size();
+
+    Arena pool;
+
+    [[maybe_unused]] PrefetchingHelper prefetching;
+    [[maybe_unused]] size_t prefetch_look_ahead = PrefetchingHelper::getInitialLookAheadValue();
+    [[maybe_unused]] bool do_prefetch = false;
+    if constexpr (CanPrefetch<Map, KeyGetter>)
+        do_prefetch = mapv.size() == 1 && mapv[0]->getBufferSizeInBytes() > min_bytes_for_prefetch;
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        if constexpr (CanPrefetch<Map, KeyGetter>)
+        {
+            if (do_prefetch)
+            {
+                if (i == PrefetchingHelper::iterationsToMeasure())
+                    prefetch_look_ahead = prefetching.calcPrefetchLookAhead();
+
+                if (i + prefetch_look_ahead < rows)
+                    mapv[0]->prefetch(key_getter_vector[0].getKeyHolder(i + prefetch_look_ahead, pool));
+            }
+        }
+
+        bool found = false;
+        for (size_t onexpr_idx = 0; !found && onexpr_idx < join_on_keys.size(); ++onexpr_idx)
+        {
+            const auto & join_keys = join_on_keys[onexpr_idx];
+            if (join_keys.null_map && (*join_keys.null_map)[i])
+                continue;
+            if (join_keys.isRowFiltered(i))
+                continue;
+
+            found = key_getter_vector[onexpr_idx].findKey(*(mapv[onexpr_idx]), i, pool).isFound();
+        }
+
+        filter[i] = is_anti ? !found : found;
+    }
+}
+
+template <bool is_anti, typename Maps>
+void switchProbeHashMapsToFilter(
+    const std::vector<const Maps *> & mapv,
+    const std::vector<JoinOnKeyColumns> & join_on_keys,
+    HashJoin::Type type,
+    IColumn::Filter & filter)
+{
+    switch (type)
+    {
+        case HashJoin::Type::EMPTY:
+        {
+            /// The hash table is empty: ANTI join keeps all rows, SEMI join keeps none.
+            if constexpr (is_anti)
+                std::fill(filter.begin(), filter.end(), 1);
+            return;
+        }
+    #define M(TYPE) \
+        case HashJoin::Type::TYPE: \
+        { \
+            using MapTypeVal = const typename std::remove_reference_t<decltype(Maps::TYPE)>::element_type; \
+            using KeyGetter = typename KeyGetterForType<HashJoin::Type::TYPE, MapTypeVal>::Type; \
+            std::vector<const MapTypeVal *> a_map_type_vector(mapv.size()); \
+            std::vector<KeyGetter> key_getter_vector; \
+            for (size_t d = 0; d < join_on_keys.size(); ++d) \
+            { \
+                const auto & join_on_key = join_on_keys[d]; \
+                a_map_type_vector[d] = mapv[d]->TYPE.get(); \
+                key_getter_vector.push_back(std::move(createKeyGetter<KeyGetter, false>(join_on_key.key_columns, join_on_key.key_sizes))); \
+            } \
+            probeHashMapsToFilter<is_anti, KeyGetter>(std::move(key_getter_vector), a_map_type_vector, join_on_keys, filter); \
+            return; \
+        }
+        APPLY_FOR_JOIN_VARIANTS(M)
+    #undef M
+
+        default:
+            throw Exception(ErrorCodes::UNSUPPORTED_JOIN_KEYS, "Unsupported JOIN keys (type: {})", type);
+    }
+}
+
 /** Since we do not store right key columns,
   * this function is used to copy left key columns to right key columns.
   * If the user requests some right columns, we just copy left key columns to right, since they are equal.
@@ -1865,6 +2154,26 @@ Block HashJoin::joinBlockImpl(
     return remaining_block;
 }
 
+template <JoinStrictness STRICTNESS, typename Maps>
+void HashJoin::joinBlockImplFilterOnly(Block & block, const std::vector<const Maps *> & maps_) const
+{
+    static_assert(STRICTNESS == JoinStrictness::Semi || STRICTNESS == JoinStrictness::Anti);
+
+    std::vector<JoinOnKeyColumns> join_on_keys;
+    const auto & onexprs = table_join->getClauses();
+    for (size_t i = 0; i < onexprs.size(); ++i)
+        join_on_keys.emplace_back(block, onexprs[i].key_names_left, onexprs[i].condColumnNames().first, key_sizes[i]);
+
+    size_t rows = block.rows();
+    IColumn::Filter filter(rows, 0);
+    switchProbeHashMapsToFilter<STRICTNESS == JoinStrictness::Anti>(maps_, join_on_keys, data->type, filter);
+    /// Do not hold memory for join_on_keys anymore
+    join_on_keys.clear();
+
+    for (size_t i = 0; i < block.columns(); ++i)
+        block.safeGetByPosition(i).column = block.safeGetByPosition(i).column->filter(filter, -1);
+}
+
 void HashJoin::joinBlockImplCross(Block & block, ExtraBlockPtr & not_processed) const
 {
     size_t start_left_row = 0;
@@ -2031,6 +2340,9 @@ void HashJoin::joinBlock(Block & block, ExtraBlockPtr & not_processed)
         materializeBlockInplace(block);
     }
 
+    if (runtime_bloom_filter)
+        filterBlockByRuntimeBloomFilter(block);
+
     {
         std::vector<const std::decay_t<decltype(data->maps[0])> * > maps_vector;
         for (size_t i = 0; i < table_join->getClauses().size(); ++i)
@@ -2038,6 +2350,18 @@ void HashJoin::joinBlock(Block & block, ExtraBlockPtr & not_processed)
 
         if (joinDispatch(kind, strictness, maps_vector, [&](auto kind_, auto strictness_, auto & maps_vector_)
         {
+            if constexpr (kind_ == JoinKind::Left && (strictness_ == JoinStrictness::Semi || strictness_ == JoinStrictness::Anti))
+            {
+                /// If the query does not use any columns from the right table, SEMI/ANTI LEFT JOIN
+                /// only filters the left block, and the added-columns machinery can be skipped.
+                if (sample_block_with_columns_to_add.columns() == 0 && required_right_keys.columns() == 0)
+                {
+                    joinBlockImplFilterOnly<strictness_>(block, maps_vector_);
+                    not_processed.reset();
+                    return;
+                }
+            }
+
             Block remaining_block = joinBlockImpl<kind_, strictness_>(block, sample_block_with_columns_to_add, maps_vector_);
             if (remaining_block.rows())
                 not_processed = std::make_shared<ExtraBlock>(ExtraBlock{std::move(remaining_block)});
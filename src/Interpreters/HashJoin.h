@@ -9,6 +9,7 @@
 
 #include <Interpreters/IJoin.h>
 #include <Interpreters/AggregationCommon.h>
+#include <Interpreters/BloomFilter.h>
 #include <Interpreters/RowRefs.h>
 
 #include <Common/Arena.h>
@@ -19,6 +20,7 @@
 
 #include <Columns/ColumnString.h>
 #include <Columns/ColumnFixedString.h>
+#include <Columns/ColumnNullable.h>
 
 #include <QueryPipeline/SizeLimits.h>
 
@@ -382,6 +384,23 @@ public:
 
     void reuseJoinedData(const HashJoin & join);
 
+    /// Register a callback to run when the build phase finishes. Used by HashJoinCache
+    /// to publish the filled join for other queries.
+    void setOnBuildFinished(std::function<void()> callback) { on_build_finished = std::move(callback); }
+
+    void onBuildFinished() override
+    {
+        if (on_build_finished)
+        {
+            on_build_finished();
+            /// The callback holds a reference to the cache which now may hold this join,
+            /// reset it to not create a reference cycle.
+            on_build_finished = {};
+        }
+    }
+
+    bool isBuildSharedWithOtherQueries() const override { return on_build_finished != nullptr; }
+
     RightTableDataPtr getJoinedData() const { return data; }
     BlocksList releaseJoinedBlocks(bool restructure = false);
 
@@ -412,6 +431,9 @@ private:
     /// This join was created from StorageJoin and it is already filled.
     bool from_storage_join = false;
 
+    /// Set when the join is registered in HashJoinCache (see setOnBuildFinished).
+    std::function<void()> on_build_finished;
+
     bool any_take_last_row; /// Overwrite existing values when encountering the same key again
     std::optional<TypeIndex> asof_type;
     const ASOFJoinInequality asof_inequality;
@@ -440,6 +462,10 @@ private:
     /// Maximum number of rows in result block. If it is 0, then no limits.
     size_t max_joined_block_rows = 0;
 
+    /// Bloom filter over the right table keys which is used to drop probe-side rows before the hash table lookup.
+    /// Created only for join kinds which do not output unmatched left rows (see join_runtime_bloom_filter_bytes).
+    BloomFilterPtr runtime_bloom_filter;
+
     /// When tracked memory consumption is more than a threshold, we will shrink to fit stored blocks.
     bool shrink_blocks = false;
     Int64 memory_usage_before_adding_blocks = 0;
@@ -456,6 +482,11 @@ private:
 
     void dataMapInit(MapsVariant &, size_t);
 
+    void addKeysToRuntimeBloomFilter(const ColumnRawPtrs & key_columns, size_t rows, ConstNullMapPtr null_map);
+
+    /// Leave in the block only the rows whose key may be present in the hash table according to the Bloom filter.
+    void filterBlockByRuntimeBloomFilter(Block & block) const;
+
     void initRightBlockStructure(Block & saved_block_sample);
 
     template <JoinKind KIND, JoinStrictness STRICTNESS, typename Maps>
@@ -465,6 +496,11 @@ private:
         const std::vector<const Maps *> & maps_,
         bool is_join_get = false) const;
 
+    /// Fast path for SEMI/ANTI LEFT JOIN which does not use any columns from the right table:
+    /// probes the hash table and filters the block in place without copying any rows.
+    template <JoinStrictness STRICTNESS, typename Maps>
+    void joinBlockImplFilterOnly(Block & block, const std::vector<const Maps *> & maps_) const;
+
     void joinBlockImplCross(Block & block, ExtraBlockPtr & not_processed) const;
 
     static Type chooseMethod(JoinKind kind, const ColumnRawPtrs & key_columns, Sizes & key_sizes);
@@ -0,0 +1,33 @@
+#include <Interpreters/HashJoinCache.h>
+
+#include <Interpreters/HashJoin.h>
+
+namespace DB
+{
+
+size_t HashJoinCache::HashJoinWeightFunction::operator()(const HashJoin & join) const
+{
+    return join.getTotalByteCount();
+}
+
+HashJoinCache::HashJoinCache(size_t max_size_in_bytes, size_t max_entries)
+    : cache(max_size_in_bytes, max_entries)
+{
+}
+
+std::shared_ptr<HashJoin> HashJoinCache::get(const Key & key)
+{
+    return cache.get(key);
+}
+
+void HashJoinCache::set(const Key & key, std::shared_ptr<HashJoin> join)
+{
+    cache.set(key, std::move(join));
+}
+
+void HashJoinCache::clear()
+{
+    cache.clear();
+}
+
+}
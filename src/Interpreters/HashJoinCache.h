@@ -0,0 +1,52 @@
+#pragma once
+
+#include <Common/CacheBase.h>
+#include <Common/HashTable/Hash.h>
+#include <base/types.h>
+
+#include <memory>
+
+namespace DB
+{
+
+class HashJoin;
+
+/// Process-wide cache of filled hash join right sides.
+///
+/// Many concurrent queries often join the same (dimension) tables and each of them builds an
+/// identical hash table. When enabled (setting use_hash_join_cache), the first query registers
+/// its HashJoin here once the build phase finishes, and later queries with the same right side
+/// reuse the built data instead of reading and hashing the right table again (the reusing
+/// query creates its own HashJoin and shares the data via HashJoin::reuseJoinedData, the same
+/// mechanism the Join table engine uses).
+///
+/// The key must identify both the join (keys, kind, strictness, right header, relevant
+/// settings) and the snapshot of the right table data (the set of active parts), so entries
+/// become unreachable when the table data changes and are eventually evicted.
+class HashJoinCache
+{
+public:
+    using Key = UInt128;
+
+    HashJoinCache(size_t max_size_in_bytes, size_t max_entries);
+
+    /// Returns a join whose right side was filled by an earlier query, or nullptr.
+    std::shared_ptr<HashJoin> get(const Key & key);
+
+    /// Stores a join whose build phase has finished.
+    void set(const Key & key, std::shared_ptr<HashJoin> join);
+
+    void clear();
+
+private:
+    struct HashJoinWeightFunction
+    {
+        size_t operator()(const HashJoin & join) const;
+    };
+
+    CacheBase<Key, HashJoin, UInt128Hash, HashJoinWeightFunction> cache;
+};
+
+using HashJoinCachePtr = std::shared_ptr<HashJoinCache>;
+
+}
@@ -90,6 +90,15 @@ public:
     virtual bool supportParallelJoin() const { return false; }
     virtual bool supportTotals() const { return true; }
 
+    /// Called by the filling transform after the last block of the right side has been added.
+    /// May be called from each filling stream when the join is filled in parallel.
+    virtual void onBuildFinished() {}
+
+    /// Returns true if the built right side data will be shared with other queries
+    /// (see HashJoinCache). In that case the plan must not push additional filters into
+    /// the right input: the stored data has to stay a full snapshot of the right table.
+    virtual bool isBuildSharedWithOtherQueries() const { return false; }
+
     /// Peek next stream of delayed joined blocks.
     virtual IBlocksStreamPtr getDelayedBlocks() { return nullptr; }
     virtual bool hasDelayedBlocks() const { return false; }
@@ -763,6 +763,9 @@ InterpreterCreateQuery::TableProperties InterpreterCreateQuery::getTableProperti
                 if (index_desc.type == "usearch" && !settings.allow_experimental_usearch_index)
                     throw Exception(ErrorCodes::INCORRECT_QUERY, "USearch index is disabled. Turn on allow_experimental_usearch_index");
 
+                if (index_desc.type == "uniq_sketch" && !settings.allow_experimental_uniq_sketch_index)
+                    throw Exception(ErrorCodes::INCORRECT_QUERY, "uniq_sketch index is disabled. Turn on allow_experimental_uniq_sketch_index");
+
                 properties.indices.push_back(index_desc);
             }
 
@@ -92,6 +92,17 @@ void InterpreterFactory::registerInterpreter(const std::string & name, CreatorFn
         throw Exception(ErrorCodes::LOGICAL_ERROR, "InterpreterFactory: the interpreter name '{}' is not unique", name);
 }
 
+/// On a cache of analyzed plans keyed by a normalized query fingerprint: the seam is here,
+/// but a plan in this codebase is not rebindable. Literal values are folded into the plan
+/// during analysis, not kept as placeholders - they become part of ActionsDAG node names,
+/// drive PREWHERE placement and index analysis (mark ranges depend on the concrete constant),
+/// and select projection/aggregation variants. A plan built for one binding is therefore a
+/// different plan for another, and reusing it would silently pessimize or mis-prune. The
+/// plan also captures a storage snapshot (parts list, metadata version), which is taken per
+/// query and cannot outlive it. What can be shared safely across identical parameterized
+/// queries is the result, which is what the query cache (use_query_cache) does; on the
+/// planning side the cheap win is prepared statements at the protocol level (query with
+/// {param:Type}), which at least skips re-parsing the literal-heavy text.
 InterpreterFactory::InterpreterPtr InterpreterFactory::get(ASTPtr & query, ContextMutablePtr context, const SelectQueryOptions & options)
 {
     ProfileEvents::increment(ProfileEvents::Query);
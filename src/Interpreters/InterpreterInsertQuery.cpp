@@ -630,6 +630,17 @@ BlockIO InterpreterInsertQuery::execute()
 
         size_t num_select_threads = pipeline.getNumThreads();
 
+        /// The select pipeline and the sink chains become one pipeline here, so a stalled sink
+        /// (part commit, Keeper round-trip) backpressures the scan through full ports - by
+        /// design, since it is what bounds memory for INSERT SELECT. An elastic buffer stage
+        /// spilling to TemporaryDataOnDisk would hide sink jitter but turns every sink stall
+        /// into disk traffic that later has to be read back through the same sink, so it only
+        /// pays off when the sink's *average* rate matches the scan and only the variance
+        /// hurts. The slack that exists today is structural: max_insert_threads independent
+        /// sink chains commit in parallel (stalls on one chain do not idle the others), and
+        /// squashing decouples scan block cadence from part granularity. For backfills bounded
+        /// by commit jitter, more sink chains and larger min_insert_block_size_rows are the
+        /// intended levers.
         for (auto & chain : presink_chains)
             resources = chain.detachResources();
         for (auto & chain : sink_chains)
@@ -1765,7 +1765,8 @@ void InterpreterSelectQuery::executeImpl(QueryPlan & query_plan, std::optional<P
                         expressions.join,
                         settings.max_block_size,
                         max_streams,
-                        analysis_result.optimize_read_in_order);
+                        analysis_result.optimize_read_in_order,
+                        settings.join_probe_read_ahead_bytes);
 
                     join_step->setStepDescription(fmt::format("JOIN {}", expressions.join->pipelineType()));
                     std::vector<QueryPlanPtr> plans;
@@ -2689,6 +2690,7 @@ static Aggregator::Params getAggregatorParams(
         settings.enable_software_prefetch_in_aggregation,
         /* only_merge */ false,
         settings.optimize_group_by_constant_keys,
+        settings.enable_adaptive_partial_aggregation_bypass,
         settings.min_hit_rate_to_use_consecutive_keys_optimization,
         stats_collecting_params
     };
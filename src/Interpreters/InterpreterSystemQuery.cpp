@@ -48,6 +48,8 @@
 #include <Disks/ObjectStorages/IMetadataStorage.h>
 #include <Storages/StorageDistributed.h>
 #include <Storages/StorageReplicatedMergeTree.h>
+#include <Storages/MergeTree/MergeTreeData.h>
+#include <Common/threadPoolCallbackRunner.h>
 #include <Storages/Freeze.h>
 #include <Storages/StorageFactory.h>
 #include <Storages/StorageFile.h>
@@ -694,6 +696,9 @@ BlockIO InterpreterSystemQuery::execute()
         case Type::WAIT_LOADING_PARTS:
             waitLoadingParts();
             break;
+        case Type::PREWARM_FILESYSTEM_CACHE:
+            prewarmFilesystemCache();
+            break;
         case Type::RESTART_DISK:
             restartDisk(query.disk);
         case Type::FLUSH_LOGS:
@@ -1148,6 +1153,50 @@ void InterpreterSystemQuery::waitLoadingParts()
     }
 }
 
+void InterpreterSystemQuery::prewarmFilesystemCache()
+{
+    getContext()->checkAccess(AccessType::SYSTEM_PREWARM_FILESYSTEM_CACHE, table_id);
+    StoragePtr table = DatabaseCatalog::instance().getTable(table_id, getContext());
+
+    auto * merge_tree = dynamic_cast<MergeTreeData *>(table.get());
+    if (!merge_tree)
+        throw Exception(ErrorCodes::BAD_ARGUMENTS,
+            "Command PREWARM FILESYSTEM CACHE is supported only for MergeTree table, but got: {}", table->getName());
+
+    /// Read every file of every active part through the cache: the cached read buffer
+    /// populates the cache as a side effect, so a read-through with discarded data is all
+    /// that is needed. Parts on local disks have nothing to prime and are skipped.
+    ReadSettings read_settings = getContext()->getReadSettings();
+    read_settings.enable_filesystem_cache = true;
+    read_settings.read_from_filesystem_cache_if_exists_otherwise_bypass_cache = false;
+    /// Priming should lose to query traffic in the reader thread pools.
+    read_settings.priority = Priority{1};
+
+    LOG_TRACE(log, "Warming up filesystem cache for table {}", table_id.getFullTableName());
+
+    ThreadPoolCallbackRunnerLocal<void> runner(getContext()->getPrefetchThreadpool(), "FSCachePrewarm");
+    for (const auto & part : merge_tree->getDataPartsVectorForInternalUsage())
+    {
+        if (!part->getDataPartStorage().isStoredOnRemoteDisk())
+            continue;
+
+        runner([part, read_settings]
+        {
+            for (auto it = part->getDataPartStorage().iterate(); it->isValid(); it->next())
+            {
+                if (part->getDataPartStorage().isDirectory(it->name()))
+                    continue;
+
+                auto buf = part->getDataPartStorage().readFile(it->name(), read_settings, std::nullopt, std::nullopt);
+                buf->ignoreAll();
+            }
+        });
+    }
+    runner.waitForAllToFinishAndRethrowFirstError();
+
+    LOG_TRACE(log, "Finished warming up filesystem cache for table {}", table_id.getFullTableName());
+}
+
 void InterpreterSystemQuery::syncReplicatedDatabase(ASTSystemQuery & query)
 {
     const auto database_name = query.getDatabase();
@@ -1407,6 +1456,11 @@ AccessRightsElements InterpreterSystemQuery::getRequiredAccessForDDLOnCluster()
             required_access.emplace_back(AccessType::SYSTEM_WAIT_LOADING_PARTS, query.getDatabase(), query.getTable());
             break;
         }
+        case Type::PREWARM_FILESYSTEM_CACHE:
+        {
+            required_access.emplace_back(AccessType::SYSTEM_PREWARM_FILESYSTEM_CACHE, query.getDatabase(), query.getTable());
+            break;
+        }
         case Type::SYNC_DATABASE_REPLICA:
         {
             required_access.emplace_back(AccessType::SYSTEM_SYNC_DATABASE_REPLICA, query.getDatabase());
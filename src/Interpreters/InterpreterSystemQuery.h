@@ -60,6 +60,7 @@ private:
     void syncReplica(ASTSystemQuery & query);
     void setReplicaReadiness(bool ready);
     void waitLoadingParts();
+    void prewarmFilesystemCache();
 
     void syncReplicatedDatabase(ASTSystemQuery & query);
 
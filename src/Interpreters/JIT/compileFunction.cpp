@@ -253,31 +253,32 @@ static void compileAddIntoAggregateStatesFunctions(llvm::Module & module,
     auto * entry = llvm::BasicBlock::Create(b.getContext(), "entry", add_into_aggregate_states_func);
     b.SetInsertPoint(entry);
 
+    /// Columns are indexed by the argument slots, so a column shared by several functions is initialized only once.
     std::vector<ColumnDataPlaceholder> columns;
-    size_t previous_columns_size = 0;
 
     for (const auto & function : functions)
     {
         auto argument_types = function.function->getArgumentTypes();
         size_t function_arguments_size = argument_types.size();
 
-        ColumnDataPlaceholder data_placeholder;
-
         for (size_t column_argument_index = 0; column_argument_index < function_arguments_size; ++column_argument_index)
         {
+            size_t slot = function.argument_column_indexes[column_argument_index];
+            if (slot >= columns.size())
+                columns.resize(slot + 1);
+
+            if (columns[slot].data_ptr)
+                continue;
+
             const auto & argument_type = argument_types[column_argument_index];
-            auto * data = b.CreateLoad(column_type, b.CreateConstInBoundsGEP1_64(column_type, columns_arg, previous_columns_size + column_argument_index));
+            auto * data = b.CreateLoad(column_type, b.CreateConstInBoundsGEP1_64(column_type, columns_arg, slot));
 
-            data_placeholder.data_ptr = b.CreateExtractValue(data, {0});
-            data_placeholder.data_element_type = toNativeType(b, removeNullable(argument_type));
+            columns[slot].data_ptr = b.CreateExtractValue(data, {0});
+            columns[slot].data_element_type = toNativeType(b, removeNullable(argument_type));
 
             if (argument_type->isNullable())
-                data_placeholder.null_data_ptr = b.CreateExtractValue(data, {1});
-
-            columns.emplace_back(data_placeholder);
+                columns[slot].null_data_ptr = b.CreateExtractValue(data, {1});
         }
-
-        previous_columns_size += function_arguments_size;
     }
 
     /// Initialize loop
@@ -302,7 +303,9 @@ static void compileAddIntoAggregateStatesFunctions(llvm::Module & module,
         aggregation_place = places_arg;
 
     ValuesWithType function_arguments;
-    previous_columns_size = 0;
+
+    /// Values loaded from each slot in the current row; a slot shared by several functions is loaded only once.
+    std::vector<llvm::Value *> loaded_columns_values(columns.size(), nullptr);
 
     for (const auto & function : functions)
     {
@@ -311,13 +314,21 @@ static void compileAddIntoAggregateStatesFunctions(llvm::Module & module,
 
         for (size_t column_argument_index = 0; column_argument_index < function_arguments_size; ++column_argument_index)
         {
-            auto & column = columns[previous_columns_size + column_argument_index];
+            size_t slot = function.argument_column_indexes[column_argument_index];
             const auto & argument_type = arguments_types[column_argument_index];
 
+            if (loaded_columns_values[slot])
+            {
+                function_arguments.emplace_back(loaded_columns_values[slot], argument_type);
+                continue;
+            }
+
+            auto & column = columns[slot];
             auto * column_data_element = b.CreateLoad(column.data_element_type, b.CreateGEP(column.data_element_type, column.data_ptr, counter_phi));
 
             if (!argument_type->isNullable())
             {
+                loaded_columns_values[slot] = column_data_element;
                 function_arguments.emplace_back(column_data_element, argument_type);
                 continue;
             }
@@ -327,6 +338,7 @@ static void compileAddIntoAggregateStatesFunctions(llvm::Module & module,
             auto * nullable_unitialized = llvm::Constant::getNullValue(toNullableType(b, column.data_element_type));
             auto * first_insert = b.CreateInsertValue(nullable_unitialized, column_data_element, {0});
             auto * nullable_value = b.CreateInsertValue(first_insert, is_null, {1});
+            loaded_columns_values[slot] = nullable_value;
             function_arguments.emplace_back(nullable_value, argument_type);
         }
 
@@ -337,8 +349,6 @@ static void compileAddIntoAggregateStatesFunctions(llvm::Module & module,
         aggregate_function_ptr->compileAdd(b, aggregation_place_with_offset, function_arguments);
 
         function_arguments.clear();
-
-        previous_columns_size += function_arguments_size;
     }
 
     /// End of loop
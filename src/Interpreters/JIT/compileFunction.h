@@ -51,6 +51,12 @@ struct AggregateFunctionWithOffset
 {
     const IAggregateFunction * function;
     size_t aggregate_data_offset;
+
+    /** For each argument of the function - its slot in the ColumnData array passed to the compiled loop.
+      * Arguments of different functions that read the same column share a slot,
+      * so the generated loop loads each distinct column only once per row.
+      */
+    std::vector<size_t> argument_column_indexes;
 };
 
 using JITCreateAggregateStatesFunction = void (*)(AggregateDataPtr);
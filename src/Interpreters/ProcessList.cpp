@@ -65,6 +65,18 @@ static bool isUnlimitedQuery(const IAST * ast)
 }
 
 
+/// Admission here counts queries rather than estimated cost for a structural reason: the entry
+/// must exist before the query is analyzed (planning itself needs a cancellation point and a
+/// memory tracker), and the only usable cost estimate - bytes selected by ReadFromMergeTree
+/// index analysis - appears well after that. Re-admitting after planning would mean throwing
+/// away work exactly when the node is overloaded. Cost-aware control in this codebase is
+/// therefore layered behind admission instead: per-class concurrency via settings profiles
+/// (max_concurrent_queries_for_user / _for_all_users, see the comment below), per-class memory
+/// budgets via the MemoryTracker hierarchy and max_memory_usage_for_user, CPU degradation via
+/// ConcurrencyControl, and IO arbitration via the workload scheduler (SETTINGS workload).
+/// Hard per-query ceilings on estimated size (max_rows_to_read / max_bytes_to_read with
+/// read_overflow_mode = 'throw') fire right after index analysis and are the closest thing to
+/// cost-based rejection that does not require admitting blind.
 ProcessList::EntryPtr
 ProcessList::insert(const String & query_, const IAST * ast, ContextMutablePtr query_context, UInt64 watch_start_nanoseconds)
 {
@@ -27,6 +27,13 @@ namespace DB
   *
   * NOTE Possibilities for improvement:
   * - implement limit on maximum number of running queries with same priority.
+  *
+  * This freeze is the cooperative-suspension point the executor has today: preempted queries
+  * park at a progress checkpoint (chunk boundary) and show up in the QueryPreempted metric,
+  * but they keep their memory and pipeline state while parked. Releasing that memory would
+  * mean serializing in-flight operator state, which only the spill-capable operators (sort,
+  * aggregation, grace hash join) could express; processors in general have no save/restore
+  * contract, so suspension stops at "stop consuming CPU", not "release all resources".
   */
 class QueryPriorities
 {
@@ -113,6 +113,7 @@ TableJoin::TableJoin(const Settings & settings, VolumePtr tmp_volume_)
     , partial_merge_join_left_table_buffer_bytes(settings.partial_merge_join_left_table_buffer_bytes)
     , max_files_to_merge(settings.join_on_disk_max_files_to_merge)
     , temporary_files_codec(settings.temporary_files_codec)
+    , runtime_bloom_filter_bytes(settings.join_runtime_bloom_filter_bytes)
     , max_memory_usage(settings.max_memory_usage)
     , tmp_volume(tmp_volume_)
 {
@@ -1087,7 +1087,8 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
             {
                 if (can_use_query_cache && settings.enable_reads_from_query_cache)
                 {
-                    QueryCache::Key key(ast, context->getUserID(), context->getCurrentRoles());
+                    UInt64 tables_data_version = settings.query_cache_invalidate_on_data_change ? queriedTablesDataVersion(ast, context) : 0;
+                    QueryCache::Key key(ast, context->getUserID(), context->getCurrentRoles(), tables_data_version);
                     QueryCache::Reader reader = query_cache->createReader(key);
                     if (reader.hasCacheEntryForKey())
                     {
@@ -1214,7 +1215,8 @@ static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
                                 context->getUserID(), context->getCurrentRoles(),
                                 settings.query_cache_share_between_users,
                                 std::chrono::system_clock::now() + std::chrono::seconds(settings.query_cache_ttl),
-                                settings.query_cache_compress_entries);
+                                settings.query_cache_compress_entries,
+                                settings.query_cache_invalidate_on_data_change ? queriedTablesDataVersion(ast, context) : 0);
 
                             const size_t num_query_runs = settings.query_cache_min_query_runs ? query_cache->recordQueryRun(key) : 1; /// try to avoid locking a mutex in recordQueryRun()
                             if (num_query_runs <= settings.query_cache_min_query_runs)
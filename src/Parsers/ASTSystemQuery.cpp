@@ -189,6 +189,7 @@ void ASTSystemQuery::formatImpl(const FormatSettings & settings, FormatState & s
         case Type::RESTORE_REPLICA:
         case Type::SYNC_REPLICA:
         case Type::WAIT_LOADING_PARTS:
+        case Type::PREWARM_FILESYSTEM_CACHE:
         case Type::FLUSH_DISTRIBUTED:
         {
             if (table)
@@ -89,6 +89,7 @@ public:
         DISABLE_FAILPOINT,
         WAIT_FAILPOINT,
         SYNC_FILESYSTEM_CACHE,
+        PREWARM_FILESYSTEM_CACHE,
         STOP_PULLING_REPLICATION_LOG,
         START_PULLING_REPLICATION_LOG,
         STOP_CLEANUP,
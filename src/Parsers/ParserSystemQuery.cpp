@@ -276,6 +276,7 @@ bool ParserSystemQuery::parseImpl(IParser::Pos & pos, ASTPtr & node, Expected &
         case Type::RESTART_REPLICA:
         case Type::SYNC_REPLICA:
         case Type::WAIT_LOADING_PARTS:
+        case Type::PREWARM_FILESYSTEM_CACHE:
         {
             if (!parseQueryWithOnCluster(res, pos, expected))
                 return false;
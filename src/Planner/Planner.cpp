@@ -395,6 +395,7 @@ Aggregator::Params getAggregatorParams(const PlannerContextPtr & planner_context
         settings.enable_software_prefetch_in_aggregation,
         /* only_merge */ false,
         settings.optimize_group_by_constant_keys,
+        settings.enable_adaptive_partial_aggregation_bypass,
         settings.min_hit_rate_to_use_consecutive_keys_optimization,
         stats_collecting_params);
 
@@ -1223,6 +1224,14 @@ Planner::Planner(const QueryTreeNodePtr & query_tree_,
 {
 }
 
+/// Planning is one-shot: the plan built here is final, and no operator re-enters the planner
+/// when observed cardinalities diverge from assumptions. Mid-query re-planning does not fit
+/// this execution model - by the time a misestimate is observable the pipeline's sources are
+/// partially consumed and stateful operators hold intermediate results that a new plan could
+/// not adopt. Instead, adaptivity lives inside operators, where state survives the switch:
+/// aggregation converts to two-level and spills when it grows, grace hash join re-buckets,
+/// sorting falls back to external merge. A runtime join side swap would follow the same
+/// pattern (a join operator deciding after seeing the build side), not a planner re-entry.
 void Planner::buildQueryPlanIfNeeded()
 {
     if (query_plan.isInitialized())
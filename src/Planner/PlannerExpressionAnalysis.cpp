@@ -474,6 +474,15 @@ LimitByAnalysisResult analyzeLimitBy(const QueryNode & query_node,
 
 }
 
+/// The stage DAGs built here are chained, not independent, which is what gives cross-stage
+/// CSE: action nodes are named canonically from the query tree, each step of ActionsChain
+/// exposes everything it computed as available output columns to later steps, and chain
+/// finalization resolves a later stage's input by name before recomputing it. A subexpression
+/// shared by WHERE and SELECT is therefore evaluated in the WHERE step and rides through the
+/// pipeline as a column. The scheme is name-based, so it only catches subtrees that are
+/// canonically identical - semantically equal expressions spelled differently still compute
+/// twice, and PREWHERE conjuncts split off later in plan optimization rejoin this chain
+/// through the same name lookup.
 PlannerExpressionsAnalysisResult buildExpressionAnalysisResult(const QueryTreeNodePtr & query_tree,
     const ColumnsWithTypeAndName & join_tree_input_columns,
     const PlannerContextPtr & planner_context,
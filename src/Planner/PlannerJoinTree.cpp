@@ -44,6 +44,7 @@
 #include <Processors/QueryPlan/ExpressionStep.h>
 #include <Processors/QueryPlan/FilterStep.h>
 #include <Processors/QueryPlan/JoinStep.h>
+#include <Processors/QueryPlan/ReadFromMergeTree.h>
 #include <Processors/QueryPlan/ArrayJoinStep.h>
 #include <Processors/Sources/SourceFromSingleChunk.h>
 
@@ -456,6 +457,17 @@ void updatePrewhereOutputsIfNeeded(SelectQueryInfo & table_expression_query_info
     prewhere_outputs.insert(prewhere_outputs.end(), required_output_nodes.begin(), required_output_nodes.end());
 }
 
+/// Row policies are not the index-killer they are reputed to be in this path. The expensive
+/// part - merging potentially hundreds of policies into one predicate per (user, table) - is
+/// cached as an AST in RowPolicyCache and reused across queries; only the cheap
+/// AST-to-ActionsDAG analysis happens per query, and it must: the DAG binds concrete column
+/// types from the current storage snapshot, so a pre-compiled per-(user, table) DAG would go
+/// stale on any ALTER. Once built, the filter is handed to add_filter like a user WHERE: it
+/// becomes the PREWHERE row-level filter when the storage allows it, and a tenant-id
+/// predicate over partition or primary-key columns prunes parts and marks through the same
+/// index analysis as any other condition. If policies defeat indexes in practice, the cause
+/// is usually predicate shape (e.g. tenant_id IN (SELECT ...) is not KeyCondition-friendly),
+/// not the policy machinery.
 FilterDAGInfo buildRowPolicyFilterIfNeeded(const StoragePtr & storage,
     SelectQueryInfo & table_expression_query_info,
     PlannerContextPtr & planner_context,
@@ -1065,6 +1077,31 @@ void joinCastPlanColumnsToNullable(QueryPlan & plan_to_add_cast, PlannerContextP
     plan_to_add_cast.addStep(std::move(cast_join_columns_step));
 }
 
+/// Estimate the number of rows the subplan reads from the storage, looking through the steps
+/// which do not add rows. Returns nothing if the estimation is not possible.
+std::optional<UInt64> estimateReadRowsCount(const QueryPlan::Node & node)
+{
+    const IQueryPlanStep * step = node.step.get();
+
+    if (const auto * read_from_merge_tree = typeid_cast<const ReadFromMergeTree *>(step))
+    {
+        auto analyzed_result = read_from_merge_tree->selectRangesToRead(
+            read_from_merge_tree->getParts(), read_from_merge_tree->getAlterConvertionsForParts());
+        if (!analyzed_result)
+            return {};
+        return analyzed_result->selected_rows;
+    }
+
+    if (node.children.size() != 1)
+        return {};
+
+    /// Filters can only reduce the number of rows, so the estimation stays an upper bound.
+    if (typeid_cast<const ExpressionStep *>(step) || typeid_cast<const FilterStep *>(step))
+        return estimateReadRowsCount(*node.children.front());
+
+    return {};
+}
+
 JoinTreeQueryPlan buildQueryPlanForJoinNode(const QueryTreeNodePtr & join_table_expression,
     JoinTreeQueryPlan left_join_tree_query_plan,
     JoinTreeQueryPlan right_join_tree_query_plan,
@@ -1089,6 +1126,31 @@ JoinTreeQueryPlan buildQueryPlanForJoinNode(const QueryTreeNodePtr & join_table_
     auto right_plan = std::move(right_join_tree_query_plan.query_plan);
     auto right_plan_output_columns = right_plan.getCurrentDataStream().header.getColumnsWithTypeAndName();
 
+    /// Make the side with fewer estimated rows to read the right (build) side.
+    /// Only INNER ALL JOIN with an ON expression is swapped: the sides of USING columns and
+    /// the semantics of the other strictnesses depend on the order of the tables.
+    if (planner_context->getQueryContext()->getSettingsRef().query_plan_join_swap_table
+        && join_node.getKind() == JoinKind::Inner
+        && join_node.getStrictness() == JoinStrictness::All
+        && join_node.isOnJoinExpression())
+    {
+        auto left_rows = estimateReadRowsCount(*left_plan.getRootNode());
+        auto right_rows = estimateReadRowsCount(*right_plan.getRootNode());
+
+        if (left_rows && right_rows && *left_rows < *right_rows)
+        {
+            LOG_TRACE(
+                getLogger("Planner"),
+                "Swapping JOIN sides, estimated rows to read: left {}, right {}",
+                *left_rows,
+                *right_rows);
+
+            std::swap(join_node.getLeftTableExpression(), join_node.getRightTableExpression());
+            std::swap(left_plan, right_plan);
+            std::swap(left_plan_output_columns, right_plan_output_columns);
+        }
+    }
+
     // {
     //     WriteBufferFromOwnString buf;
     //     left_plan.explainPlan(buf, {.header = true, .actions = true});
@@ -1457,7 +1519,8 @@ JoinTreeQueryPlan buildQueryPlanForJoinNode(const QueryTreeNodePtr & join_table_
             std::move(join_algorithm),
             settings.max_block_size,
             settings.max_threads,
-            false /*optimize_read_in_order*/);
+            false /*optimize_read_in_order*/,
+            settings.join_probe_read_ahead_bytes);
 
         join_step->setStepDescription(fmt::format("JOIN {}", join_pipeline_type));
 
@@ -1468,6 +1531,12 @@ JoinTreeQueryPlan buildQueryPlanForJoinNode(const QueryTreeNodePtr & join_table_
         result_plan.unitePlans(std::move(join_step), {std::move(plans)});
     }
 
+    /// Column liveness is enforced at the points where columns actually die rather than by a
+    /// generic per-stage pruning pass: join keys and other columns not referenced by the outer
+    /// scope are dropped right here, ARRAY JOIN gets the same treatment below, and columns used
+    /// only by PREWHERE never leave the range reader (remove_prewhere_column). Between those
+    /// points each step's ActionsDAG already projects exactly its required outputs, so there is
+    /// no span where a dead column would survive for an extra stage.
     auto drop_unused_columns_after_join_actions_dag = std::make_shared<ActionsDAG>(result_plan.getCurrentDataStream().header.getColumnsWithTypeAndName());
     ActionsDAG::NodeRawConstPtrs drop_unused_columns_after_join_actions_dag_updated_outputs;
     std::unordered_set<std::string_view> drop_unused_columns_after_join_actions_dag_updated_outputs_names;
@@ -14,6 +14,12 @@
 #include <Storages/IStorage.h>
 #include <Storages/StorageJoin.h>
 #include <Storages/StorageDictionary.h>
+#include <Storages/MergeTree/MergeTreeData.h>
+
+#include <Access/Common/RowPolicyDefs.h>
+
+#include <Common/ProfileEvents.h>
+#include <Common/SipHash.h>
 
 #include <Functions/IFunction.h>
 #include <Functions/FunctionFactory.h>
@@ -29,6 +35,7 @@
 #include <Dictionaries/IDictionary.h>
 #include <Interpreters/IKeyValueEntity.h>
 #include <Interpreters/HashJoin.h>
+#include <Interpreters/HashJoinCache.h>
 #include <Interpreters/MergeJoin.h>
 #include <Interpreters/FullSortingMergeJoin.h>
 #include <Interpreters/ConcurrentHashJoin.h>
@@ -42,6 +49,12 @@
 #include <Planner/PlannerContext.h>
 #include <Planner/Utils.h>
 
+namespace ProfileEvents
+{
+    extern const Event HashJoinCacheHits;
+    extern const Event HashJoinCacheMisses;
+}
+
 namespace DB
 {
 
@@ -839,6 +852,72 @@ static std::shared_ptr<IJoin> tryCreateJoin(JoinAlgorithm algorithm,
     return nullptr;
 }
 
+
+/** Calculate the hash join cache key for the right side of a join, or return nothing if the
+  * built right side cannot be shared between queries. The key must identify the join result
+  * of the build phase completely: the snapshot of the right table data (the set of active
+  * parts), the join keys, kind, strictness, the right stream header and the settings which
+  * affect the stored blocks. Anything that can make the right stream differ from a full
+  * snapshot of the table (expression subqueries, FINAL, SAMPLE, row policies, additional
+  * filters, reading with parallel replicas) disables caching.
+  */
+static std::optional<UInt128> calculateHashJoinCacheKey(const TableJoin & table_join,
+    const QueryTreeNodePtr & right_table_expression,
+    const Block & right_table_expression_header,
+    const ContextPtr & query_context)
+{
+    const auto & settings = query_context->getSettingsRef();
+
+    if (settings.allow_experimental_parallel_reading_from_replicas || !settings.additional_table_filters.value.empty())
+        return {};
+
+    if (isCrossOrComma(table_join.kind()) || table_join.strictness() == JoinStrictness::Asof || !table_join.oneDisjunct())
+        return {};
+
+    const auto * table_node = right_table_expression->as<TableNode>();
+    if (!table_node || table_node->hasTableExpressionModifiers())
+        return {};
+
+    const auto & storage = table_node->getStorage();
+    const auto * merge_tree = dynamic_cast<const MergeTreeData *>(storage.get());
+    if (!merge_tree)
+        return {};
+
+    auto storage_id = storage->getStorageID();
+    if (query_context->getRowPolicyFilter(storage_id.getDatabaseName(), storage_id.getTableName(), RowPolicyFilterType::SELECT_FILTER))
+        return {};
+
+    SipHash hash;
+    hash.update(storage_id.getFullTableName());
+
+    /// Version of the table data. Part names change on inserts, merges, mutations and drops.
+    /// Combine them commutatively, the order of the parts in the vector must not matter.
+    UInt64 parts_hash = 0;
+    for (const auto & part : merge_tree->getDataPartsVectorForInternalUsage())
+        parts_hash += sipHash64(part->name.data(), part->name.size());
+    hash.update(parts_hash);
+
+    hash.update(table_join.kind());
+    hash.update(table_join.strictness());
+    hash.update(settings.join_use_nulls.value);
+    hash.update(settings.any_join_distinct_right_table_keys.value);
+
+    const auto & clause = table_join.getOnlyClause();
+    for (const auto & name : clause.key_names_left)
+        hash.update(name);
+    for (const auto & name : clause.key_names_right)
+        hash.update(name);
+    const auto & [left_condition_column, right_condition_column] = clause.condColumnNames();
+    hash.update(left_condition_column);
+    hash.update(right_condition_column);
+    for (size_t i = 0; i < clause.keysCount(); ++i)
+        hash.update(clause.nullsafe_compare_key_indexes.contains(i));
+
+    hash.update(right_table_expression_header.getNamesAndTypesList().toString());
+
+    return hash.get128();
+}
+
 std::shared_ptr<IJoin> chooseJoinAlgorithm(std::shared_ptr<TableJoin> & table_join,
     const QueryTreeNodePtr & right_table_expression,
     const Block & left_table_expression_header,
@@ -881,11 +960,41 @@ std::shared_ptr<IJoin> chooseJoinAlgorithm(std::shared_ptr<TableJoin> & table_jo
     if (!table_join->oneDisjunct() && !table_join->isEnabledAlgorithm(JoinAlgorithm::HASH) && !table_join->isEnabledAlgorithm(JoinAlgorithm::AUTO))
         throw Exception(ErrorCodes::NOT_IMPLEMENTED, "Only `hash` join supports multiple ORs for keys in JOIN ON section");
 
+    auto query_context = planner_context->getQueryContext();
+    HashJoinCachePtr hash_join_cache;
+    if (query_context->getSettingsRef().use_hash_join_cache)
+        hash_join_cache = query_context->getHashJoinCache();
+
     for (auto algorithm : table_join->getEnabledJoinAlgorithms())
     {
         auto join = tryCreateJoin(algorithm, table_join, right_table_expression, left_table_expression_header, right_table_expression_header, planner_context);
-        if (join)
-            return join;
+        if (!join)
+            continue;
+
+        auto * hash_join = hash_join_cache ? typeid_cast<HashJoin *>(join.get()) : nullptr;
+        if (hash_join)
+        {
+            if (auto key = calculateHashJoinCacheKey(*table_join, right_table_expression, right_table_expression_header, query_context))
+            {
+                if (auto cached_join = hash_join_cache->get(*key))
+                {
+                    ProfileEvents::increment(ProfileEvents::HashJoinCacheHits);
+                    hash_join->reuseJoinedData(*cached_join);
+                }
+                else
+                {
+                    ProfileEvents::increment(ProfileEvents::HashJoinCacheMisses);
+                    hash_join->setOnBuildFinished(
+                        [cache = hash_join_cache, cache_key = *key, join_weak = std::weak_ptr<IJoin>(join)]
+                        {
+                            if (auto filled_join = std::dynamic_pointer_cast<HashJoin>(join_weak.lock()))
+                                cache->set(cache_key, std::move(filled_join));
+                        });
+                }
+            }
+        }
+
+        return join;
     }
 
     throw Exception(ErrorCodes::NOT_IMPLEMENTED,
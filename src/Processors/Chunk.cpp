@@ -226,6 +226,24 @@ void convertToFullIfSparse(Chunk & chunk)
     chunk.setColumns(std::move(columns), num_rows);
 }
 
+void compressChunk(Chunk & chunk)
+{
+    size_t num_rows = chunk.getNumRows();
+    auto columns = chunk.detachColumns();
+    for (auto & column : columns)
+        column = column->compress();
+    chunk.setColumns(std::move(columns), num_rows);
+}
+
+void decompressChunk(Chunk & chunk)
+{
+    size_t num_rows = chunk.getNumRows();
+    auto columns = chunk.detachColumns();
+    for (auto & column : columns)
+        column = column->decompress();
+    chunk.setColumns(std::move(columns), num_rows);
+}
+
 Chunk cloneConstWithDefault(const Chunk & chunk, size_t num_rows)
 {
     auto columns = chunk.cloneEmptyColumns();
@@ -156,6 +156,12 @@ private:
 void convertToFullIfConst(Chunk & chunk);
 void convertToFullIfSparse(Chunk & chunk);
 
+/// Compress columns of the chunk in memory (see ColumnCompressed).
+/// Used for chunks that are buffered for a long time to trade CPU for lower peak memory usage.
+/// Columns that don't support in-memory compression are kept as is.
+void compressChunk(Chunk & chunk);
+void decompressChunk(Chunk & chunk);
+
 /// Creates a chunk with the same columns but makes them constants with a default value and a specified number of rows.
 Chunk cloneConstWithDefault(const Chunk & chunk, size_t num_rows);
 
@@ -14,6 +14,18 @@ namespace DB
 {
 
 /// Graph of executing pipeline.
+///
+/// This graph knows everything a live "where is my query stuck" view would need - per-node
+/// status, port counters, work/wait times - but it is owned and mutated by the executor's
+/// worker threads with no external synchronization: node statuses and port data flip without
+/// locks on the hot path, and putting a reader-visible lock around them would tax every
+/// prepare() call to serve an occasional inspection. A consistent external snapshot is
+/// therefore not offered. The supported live views are built from what threads publish
+/// safely on the side: system.processes carries per-query ProfileEvents as they accumulate,
+/// and system.stack_trace shows exactly which primitive each executor thread of a stuck
+/// query is blocked in. The per-processor numbers themselves are published once per
+/// processor lifetime into processors_profile_log; for a hung query, KILL ... SYNC flushes
+/// them without waiting for the query's natural death.
 class ExecutingGraph
 {
 public:
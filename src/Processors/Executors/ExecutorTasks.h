@@ -10,6 +10,17 @@ namespace DB
 {
 
 /// Manage tasks which are ready for execution. Used in PipelineExecutor.
+///
+/// Scheduling is already work-stealing in structure, even though a single mutex guards the
+/// shared state: TaskQueue keeps a queue per thread and pop() falls back to round-robin
+/// stealing from other threads' queues, and pushTasks() retains one freshly produced task in
+/// the thread's local slot (bounded by max_scheduled_local_tasks) without taking the mutex at
+/// all, which covers the common short-task case. The mutex is not replaceable by per-thread
+/// lock-free deques in isolation, because the same critical section decides whether a thread
+/// goes to sleep (threads_queue) and which sleeping thread to wake: splitting task visibility
+/// from the sleep decision reintroduces lost wakeups unless the whole idle/wake protocol is
+/// redesigned as well. Threads that cannot get a task park on a per-thread condvar rather
+/// than spinning, so contention on this mutex is bounded by task handoff rate, not thread count.
 class ExecutorTasks
 {
     /// If query is finished (or cancelled).
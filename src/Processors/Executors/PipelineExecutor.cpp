@@ -284,6 +284,14 @@ void PipelineExecutor::executeStepImpl(size_t thread_num, std::atomic_bool * yie
 #endif
 
             /// Try to execute neighbour processor.
+            ///
+            /// This is the morsel-affinity path: processors made runnable by this execution are
+            /// pushed to this thread's own queue (and one of them is kept in the mutex-free local
+            /// slot), so a chunk's downstream transforms run on the core whose cache already holds
+            /// it, and only idle threads steal across. What the executor does not do is pin threads
+            /// to cores or tag chunks with a NUMA domain: worker threads come from the shared
+            /// global pool under ConcurrencyControl and can migrate, so node-local placement would
+            /// need pinned per-domain sub-pools and a topology map that the codebase does not have.
             {
                 Queue queue;
                 Queue async_queue;
@@ -34,6 +34,14 @@ namespace ErrorCodes
 }
 
 // This is only used for parquet now.
+//
+// Resolution is leaf-level, not top-level: calculateFieldIndices() names every nested field by
+// its full dotted path with its leaf index range, and findRequiredIndices() recurses into
+// named Tuple elements of the header type, so a header that contains only a subset of struct
+// members requests only those Parquet leaf columns. Whether nested pruning actually happens is
+// therefore decided by whoever builds the header: if the query layer asks for the whole Tuple
+// and extracts the subcolumn afterwards, every leaf of the struct is read regardless of what
+// this class could skip.
 class ArrowFieldIndexUtil
 {
 public:
@@ -512,6 +512,13 @@ void registerInputFormatCSV(FormatFactory & factory)
     registerWithNamesAndTypes("CSV", register_func);
 }
 
+/// The serial stage of parallel parsing: scan forward for a row boundary that is outside of
+/// quotes, handing everything before it to a parser thread. The scan is already vectorized
+/// (find_first_symbols uses SIMD to skip to the next quote/newline), so the cost per byte is
+/// that of a memchr-class pass. Splitting speculatively at arbitrary newlines and fixing up
+/// quote state afterwards does not work for CSV: whether a position is inside a quoted field
+/// depends on the parity of all preceding quotes, so a speculative worker cannot know its
+/// starting state without having scanned the whole prefix anyway.
 std::pair<bool, size_t> fileSegmentationEngineCSVImpl(ReadBuffer & in, DB::Memory<> & memory, size_t min_bytes, size_t min_rows, size_t max_rows, const FormatSettings & settings)
 {
     char * pos = in.position();
@@ -18,6 +18,15 @@ class ReadBuffer;
   * Objects can be separated by line feed, other whitespace characters in any number and possibly a comma.
   * Fields can be listed in any order (including, in different lines there may be different order),
   *  and some fields may be missing.
+  *
+  * On performance: values are parsed by the column types themselves (ISerialization::
+  * deserializeTextJSON appends straight into the column), which is what makes arbitrary
+  * ClickHouse types, missing fields and defaults work. A simdjson-based rewrite would only
+  * accelerate the structural scan: it needs the document in padded contiguous memory rather
+  * than a ReadBuffer, and after its tape is built every value would still have to go through
+  * the per-type text parser, so the double materialization eats most of the win. Multi-core
+  * throughput comes from ParallelParsingInputFormat, whose newline segmentation is trivial
+  * for this format.
   */
 class JSONEachRowRowInputFormat : public IRowInputFormat
 {
@@ -489,6 +489,13 @@ void ParquetBlockInputFormat::initializeRowGroupBatchReader(size_t row_group_bat
     THROW_ARROW_NOT_OK(
         row_group_batch.file_reader->GetRecordBatchReader(row_group_batch.row_groups_idxs, column_indices, &row_group_batch.record_batch_reader));
 
+    /// One converter per row-group batch: its DictionaryInfo cache turns Arrow dictionary
+    /// columns into LowCardinality by converting the dictionary values once and reusing them
+    /// for every chunk of the batch (indexes are remapped, full strings are never
+    /// materialized). The cache is not shared across batches on purpose - batches decode on
+    /// different threads, and Parquet dictionary pages are physically per row group, so
+    /// "identical" dictionaries could only be found by comparing their contents, which costs
+    /// about as much as the conversion it would save.
     row_group_batch.arrow_column_to_ch_column = std::make_unique<ArrowColumnToCHColumn>(
         getPort().getHeader(),
         "Parquet",
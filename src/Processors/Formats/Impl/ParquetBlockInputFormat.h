@@ -43,6 +43,14 @@ class ArrowColumnToCHColumn;
 // For (1), we need the IInputFormat to be in control of reading, with its own implementation of
 // parallel reading+decoding, instead of using ParallelReadBuffer and ParallelParsingInputFormat.
 // That's what RandomAccessInputCreator in FormatFactory is about.
+//
+// Another known inefficiency is the Arrow round-trip: pages are decoded into Arrow arrays and
+// then converted to IColumns, i.e. one extra columnar materialization per batch. The writer
+// already bypasses Arrow (Processors/Formats/Impl/Parquet/Write.cpp); a matching native reader
+// would decode PLAIN/RLE_DICTIONARY pages for the common Int/Float/String cases straight into
+// PODArray-backed columns and keep Arrow only as the fallback for exotic types. That is a
+// whole decoder subsystem (repetition/definition levels, nesting, all the encodings), so it
+// has to land as its own module next to Write.cpp, not as a modification here.
 
 class ParquetBlockInputFormat : public IInputFormat
 {
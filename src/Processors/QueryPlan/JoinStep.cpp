@@ -44,8 +44,13 @@ JoinStep::JoinStep(
     JoinPtr join_,
     size_t max_block_size_,
     size_t max_streams_,
-    bool keep_left_read_in_order_)
-    : join(std::move(join_)), max_block_size(max_block_size_), max_streams(max_streams_), keep_left_read_in_order(keep_left_read_in_order_)
+    bool keep_left_read_in_order_,
+    size_t probe_read_ahead_bytes_)
+    : join(std::move(join_))
+    , max_block_size(max_block_size_)
+    , max_streams(max_streams_)
+    , keep_left_read_in_order(keep_left_read_in_order_)
+    , probe_read_ahead_bytes(probe_read_ahead_bytes_)
 {
     updateInputStreams(DataStreams{left_stream_, right_stream_});
 }
@@ -69,6 +74,7 @@ QueryPipelineBuilderPtr JoinStep::updatePipeline(QueryPipelineBuilders pipelines
         join,
         output_stream->header,
         max_block_size,
+        probe_read_ahead_bytes,
         max_streams,
         keep_left_read_in_order,
         &processors);
@@ -76,6 +82,11 @@ QueryPipelineBuilderPtr JoinStep::updatePipeline(QueryPipelineBuilders pipelines
 
 bool JoinStep::allowPushDownToRight() const
 {
+    /// The built right side may be reused by other queries through the hash join cache,
+    /// so it must stay a full snapshot of the right table.
+    if (join->isBuildSharedWithOtherQueries())
+        return false;
+
     return join->pipelineType() == JoinPipelineType::YShaped || join->pipelineType() == JoinPipelineType::FillRightFirst;
 }
 
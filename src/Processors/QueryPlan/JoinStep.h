@@ -19,7 +19,8 @@ public:
         JoinPtr join_,
         size_t max_block_size_,
         size_t max_streams_,
-        bool keep_left_read_in_order_);
+        bool keep_left_read_in_order_,
+        size_t probe_read_ahead_bytes_ = 0);
 
     String getName() const override { return "Join"; }
 
@@ -42,6 +43,7 @@ private:
     size_t max_block_size;
     size_t max_streams;
     bool keep_left_read_in_order;
+    size_t probe_read_ahead_bytes;
 };
 
 /// Special step for the case when Join is already filled.
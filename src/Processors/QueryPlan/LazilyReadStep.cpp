@@ -0,0 +1,157 @@
+#include <Processors/QueryPlan/LazilyReadStep.h>
+
+#include <Common/JSONBuilder.h>
+#include <IO/Operators.h>
+#include <Processors/ISimpleTransform.h>
+#include <QueryPipeline/QueryPipelineBuilder.h>
+#include <Storages/MergeTree/MergeTreeLazilyReader.h>
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int LOGICAL_ERROR;
+}
+
+static ITransformingStep::Traits getTraits()
+{
+    return ITransformingStep::Traits
+    {
+        {
+            .returns_single_stream = false,
+            .preserves_number_of_streams = true,
+            .preserves_sorting = true,
+        },
+        {
+            .preserves_number_of_rows = true,
+        }
+    };
+}
+
+namespace
+{
+
+class LazilyReadTransform : public ISimpleTransform
+{
+public:
+    LazilyReadTransform(const Block & header_, const Block & result_header_, MergeTreeLazilyReaderPtr lazy_column_reader_)
+        : ISimpleTransform(header_, result_header_, false)
+        , lazy_column_reader(std::move(lazy_column_reader_))
+        , part_index_position(header_.getPositionByName("_part_index"))
+        , part_offset_position(header_.getPositionByName("_part_offset"))
+    {
+        const auto & lazy_columns = lazy_column_reader->getColumns();
+        for (const auto & column : result_header_)
+        {
+            if (header_.has(column.name))
+            {
+                result_sources.push_back(static_cast<ssize_t>(header_.getPositionByName(column.name)));
+                continue;
+            }
+
+            ssize_t lazy_position = -1;
+            ssize_t i = 0;
+            for (const auto & lazy_column : lazy_columns)
+            {
+                if (lazy_column.name == column.name)
+                {
+                    lazy_position = i;
+                    break;
+                }
+                ++i;
+            }
+
+            if (lazy_position < 0)
+                throw Exception(ErrorCodes::LOGICAL_ERROR,
+                    "Column {} is present neither in the input of LazilyReadTransform nor in the lazily read columns", column.name);
+
+            result_sources.push_back(-1 - lazy_position);
+        }
+    }
+
+    String getName() const override { return "LazilyReadTransform"; }
+
+protected:
+    void transform(Chunk & chunk) override
+    {
+        size_t num_rows = chunk.getNumRows();
+        auto columns = chunk.detachColumns();
+
+        auto lazy_columns = lazy_column_reader->readLazyColumns(
+            *columns[part_index_position], *columns[part_offset_position]);
+
+        Columns result_columns;
+        result_columns.reserve(result_sources.size());
+        for (ssize_t source : result_sources)
+        {
+            if (source >= 0)
+                result_columns.push_back(columns[source]);
+            else
+                result_columns.push_back(lazy_columns[-source - 1]);
+        }
+
+        chunk.setColumns(std::move(result_columns), num_rows);
+    }
+
+private:
+    MergeTreeLazilyReaderPtr lazy_column_reader;
+    const size_t part_index_position;
+    const size_t part_offset_position;
+
+    /// For each column of the result: non-negative values are positions in the input header,
+    /// negative values are positions in the lazily read columns (encoded as -1 - position).
+    std::vector<ssize_t> result_sources;
+};
+
+}
+
+LazilyReadStep::LazilyReadStep(
+    const DataStream & input_stream_,
+    const Block & result_header_,
+    MergeTreeLazilyReaderPtr lazy_column_reader_)
+    : ITransformingStep(input_stream_, result_header_, getTraits())
+    , result_header(result_header_)
+    , lazy_column_reader(std::move(lazy_column_reader_))
+{
+}
+
+void LazilyReadStep::transformPipeline(QueryPipelineBuilder & pipeline, const BuildQueryPipelineSettings &)
+{
+    pipeline.addSimpleTransform([&](const Block & header)
+    {
+        return std::make_shared<LazilyReadTransform>(header, result_header, lazy_column_reader);
+    });
+}
+
+void LazilyReadStep::describeActions(FormatSettings & settings) const
+{
+    settings.out << String(settings.offset, ' ') << "Lazily read columns: ";
+
+    bool first = true;
+    for (const auto & column : lazy_column_reader->getColumns())
+    {
+        if (!first)
+            settings.out << ", ";
+        first = false;
+        settings.out << column.name;
+    }
+
+    settings.out << '\n';
+}
+
+void LazilyReadStep::describeActions(JSONBuilder::JSONMap & map) const
+{
+    auto columns_array = std::make_unique<JSONBuilder::JSONArray>();
+    for (const auto & column : lazy_column_reader->getColumns())
+        columns_array->add(column.name);
+
+    map.add("Lazily Read Columns", std::move(columns_array));
+}
+
+void LazilyReadStep::updateOutputStream()
+{
+    output_stream = createOutputStream(input_streams.front(), result_header, getDataStreamTraits());
+}
+
+}
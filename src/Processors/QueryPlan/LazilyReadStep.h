@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Processors/QueryPlan/ITransformingStep.h>
+
+namespace DB
+{
+
+class MergeTreeLazilyReader;
+using MergeTreeLazilyReaderPtr = std::shared_ptr<MergeTreeLazilyReader>;
+
+/// Reads the columns deferred by the lazy materialization optimization for the rows
+/// that survived ORDER BY ... LIMIT, using the _part_index and _part_offset virtual
+/// columns produced by ReadFromMergeTree, and restores the original header.
+class LazilyReadStep : public ITransformingStep
+{
+public:
+    LazilyReadStep(
+        const DataStream & input_stream_,
+        const Block & result_header_,
+        MergeTreeLazilyReaderPtr lazy_column_reader_);
+
+    String getName() const override { return "LazilyRead"; }
+
+    void transformPipeline(QueryPipelineBuilder & pipeline, const BuildQueryPipelineSettings &) override;
+
+    void describeActions(JSONBuilder::JSONMap & map) const override;
+    void describeActions(FormatSettings & settings) const override;
+
+private:
+    void updateOutputStream() override;
+
+    Block result_header;
+    MergeTreeLazilyReaderPtr lazy_column_reader;
+};
+
+}
@@ -111,6 +111,10 @@ bool optimizeUseAggregateProjections(QueryPlan::Node & node, QueryPlan::Nodes &
 bool optimizeUseNormalProjections(Stack & stack, QueryPlan::Nodes & nodes);
 bool addPlansForSets(QueryPlan & plan, QueryPlan::Node & node, QueryPlan::Nodes & nodes);
 
+/// Defer reading of the columns which are needed only in the final result
+/// of a query with ORDER BY and a small LIMIT until after the LIMIT is applied.
+void optimizeLazyMaterialization(QueryPlan::Node & root, QueryPlan::Nodes & nodes, size_t max_limit_for_lazy_materialization);
+
 /// Enable memory bound merging of aggregation states for remote queries
 /// in case it was enabled for local plan
 void enableMemoryBoundMerging(QueryPlan::Node & node, QueryPlan::Nodes &);
@@ -42,6 +42,10 @@ QueryPlanOptimizationSettings QueryPlanOptimizationSettings::fromSettings(const
 
     settings.remove_redundant_distinct = from.query_plan_enable_optimizations && from.query_plan_remove_redundant_distinct;
 
+    settings.lazy_materialization = from.query_plan_enable_optimizations && from.query_plan_optimize_lazy_materialization;
+
+    settings.max_limit_for_lazy_materialization = from.query_plan_max_limit_for_lazy_materialization;
+
     settings.optimize_projection = from.optimize_use_projections;
     settings.force_use_projection = settings.optimize_projection && from.force_optimize_projection;
     settings.force_projection_name = from.force_optimize_projection_name;
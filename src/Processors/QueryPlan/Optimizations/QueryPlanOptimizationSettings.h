@@ -63,6 +63,12 @@ struct QueryPlanOptimizationSettings
 
     bool optimize_prewhere = true;
 
+    /// If lazy materialization optimization is enabled.
+    bool lazy_materialization = false;
+
+    /// Maximum LIMIT value for which lazy materialization can be applied. 0 means no limitation.
+    size_t max_limit_for_lazy_materialization = 0;
+
     /// If reading from projection can be applied
     bool optimize_projection = false;
     bool force_use_projection = false;
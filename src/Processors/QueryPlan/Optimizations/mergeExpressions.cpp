@@ -6,6 +6,14 @@
 namespace DB::QueryPlanOptimizations
 {
 
+/// Collapses Expression(Expression) and Filter(Expression) pairs into a single step, so the
+/// stacked transforms seen in EXPLAIN PIPELINE fuse into one ActionsDAG execution with no
+/// intermediate full-block materialization between them. The one pair intentionally left
+/// unfused is Expression on top of Filter: the filter shrinks the block first, so the parent
+/// expression already runs only on surviving rows, and folding it into the filter's DAG would
+/// move it back to the pre-filter cardinality. Evaluating it there under a row mask would
+/// need masked execution as a general ActionsDAG mode - today the mask machinery
+/// (MaskOperations) is applied only inside short-circuit function arguments.
 size_t tryMergeExpressions(QueryPlan::Node * parent_node, QueryPlan::Nodes &)
 {
     if (parent_node->children.size() != 1)
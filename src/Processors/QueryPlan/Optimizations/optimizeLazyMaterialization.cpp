@@ -0,0 +1,233 @@
+#include <Interpreters/ActionsDAG.h>
+#include <Processors/QueryPlan/ExpressionStep.h>
+#include <Processors/QueryPlan/LazilyReadStep.h>
+#include <Processors/QueryPlan/LimitStep.h>
+#include <Processors/QueryPlan/Optimizations/Optimizations.h>
+#include <Processors/QueryPlan/ReadFromMergeTree.h>
+#include <Processors/QueryPlan/SortingStep.h>
+#include <Storages/MergeTree/MergeTreeLazilyReader.h>
+
+namespace DB
+{
+
+namespace QueryPlanOptimizations
+{
+
+namespace
+{
+
+/// The optimization defers reading of the columns which do not affect the order of rows
+/// until after ORDER BY with LIMIT leaves only a few of them. The reading step is asked
+/// to produce the _part_index and _part_offset virtual columns instead of the deferred
+/// columns, and a LazilyReadStep on top of the LIMIT fetches the deferred columns only
+/// for the rows which made it into the result.
+
+/// Columns used inside non-trivial expressions cannot be deferred:
+/// the expression is evaluated before the LIMIT.
+void collectUsedInputs(const ActionsDAG & dag, std::unordered_set<const ActionsDAG::Node *> & used_inputs)
+{
+    std::vector<const ActionsDAG::Node *> stack;
+    std::unordered_set<const ActionsDAG::Node *> visited;
+
+    for (const auto * output : dag.getOutputs())
+    {
+        /// An output which is an input itself is just a passed-through column.
+        if (output->type == ActionsDAG::ActionType::INPUT)
+            continue;
+
+        stack.push_back(output);
+    }
+
+    while (!stack.empty())
+    {
+        const auto * node = stack.back();
+        stack.pop_back();
+
+        if (!visited.emplace(node).second)
+            continue;
+
+        if (node->type == ActionsDAG::ActionType::INPUT)
+            used_inputs.insert(node);
+
+        for (const auto * child : node->children)
+            stack.push_back(child);
+    }
+}
+
+bool tryLazilyReadColumnsAfterLimit(QueryPlan::Node & node, QueryPlan::Nodes & nodes, size_t max_limit_for_lazy_materialization)
+{
+    auto * limit_step = typeid_cast<LimitStep *>(node.step.get());
+    if (!limit_step || limit_step->withTies() || node.children.size() != 1)
+        return false;
+
+    size_t limit = limit_step->getLimitForSorting();
+    if (limit == 0 || (max_limit_for_lazy_materialization && limit > max_limit_for_lazy_materialization))
+        return false;
+
+    auto * sorting_node = node.children.front();
+    auto * sorting_step = typeid_cast<SortingStep *>(sorting_node->step.get());
+    if (!sorting_step || sorting_step->getType() != SortingStep::Type::Full || sorting_node->children.size() != 1)
+        return false;
+
+    /// Optionally there is an expression between the sorting and the reading
+    /// (e.g. aliases or functions over the sorting key).
+    auto * expression_node = sorting_node->children.front();
+    auto * expression_step = typeid_cast<ExpressionStep *>(expression_node->step.get());
+
+    auto * reading_node = expression_step ? expression_node->children.front() : expression_node;
+    if (expression_step && (expression_node->children.size() != 1 || reading_node->children.size() != 0))
+        return false;
+
+    auto * reading_step = typeid_cast<ReadFromMergeTree *>(reading_node->step.get());
+    if (!reading_step)
+        return false;
+
+    /// With parallel replicas the offsets do not address the local parts.
+    /// FINAL merges rows from different offsets and sampling filters them out,
+    /// so the deferred columns cannot be restored by (part, offset) in these cases.
+    if (reading_step->isParallelReadingEnabled() || reading_step->readsInOrder()
+        || reading_step->isQueryWithFinal() || reading_step->isQueryWithSampling())
+        return false;
+
+    const auto & all_column_names = reading_step->getAllColumnNames();
+    for (const auto & column_name : all_column_names)
+        if (column_name == "_part_index" || column_name == "_part_offset")
+            return false;
+
+    NameSet sort_key_names;
+    for (const auto & sort_column : sorting_step->getSortDescription())
+        sort_key_names.insert(sort_column.column_name);
+
+    const auto & storage_columns = reading_step->getStorageMetadata()->getColumns();
+
+    /// Only physical columns can be re-read by row offset. Virtual and ephemeral
+    /// columns (including _part_index and _part_offset themselves) are left as is,
+    /// which also guarantees that the optimization is not applied twice.
+    auto can_be_lazy = [&](const String & name)
+    {
+        return !sort_key_names.contains(name) && storage_columns.hasPhysical(name);
+    };
+
+    Names lazy_names;
+    NameSet lazy_names_set;
+
+    if (expression_step)
+    {
+        const auto & dag = *expression_step->getExpression();
+
+        std::unordered_set<const ActionsDAG::Node *> used_inputs;
+        collectUsedInputs(dag, used_inputs);
+
+        for (const auto * output : dag.getOutputs())
+        {
+            if (output->type != ActionsDAG::ActionType::INPUT || used_inputs.contains(output))
+                continue;
+
+            if (can_be_lazy(output->result_name) && lazy_names_set.emplace(output->result_name).second)
+                lazy_names.push_back(output->result_name);
+        }
+    }
+    else
+    {
+        for (const auto & column : reading_step->getOutputStream().header)
+        {
+            if (can_be_lazy(column.name) && lazy_names_set.emplace(column.name).second)
+                lazy_names.push_back(column.name);
+        }
+    }
+
+    if (lazy_names.empty())
+        return false;
+
+    Block original_header = node.step->getOutputStream().header;
+
+    Names new_reading_columns;
+    new_reading_columns.reserve(all_column_names.size() - lazy_names.size() + 2);
+    for (const auto & column_name : all_column_names)
+        if (!lazy_names_set.contains(column_name))
+            new_reading_columns.push_back(column_name);
+
+    new_reading_columns.push_back("_part_index");
+    new_reading_columns.push_back("_part_offset");
+
+    /// The reading step fills the vector with the final part set (keyed by part_index_in_query)
+    /// when the pipeline is initialized: the parts known at this point may still be pruned
+    /// by the partition key or the _part filter, which would shift the indices.
+    auto lazily_read_parts = std::make_shared<LazilyReadDataParts>();
+
+    auto lazy_column_reader = std::make_shared<MergeTreeLazilyReader>(
+        reading_step->getMergeTreeData(),
+        reading_step->getStorageSnapshot(),
+        lazily_read_parts,
+        lazy_names,
+        reading_step->getContext());
+
+    reading_step->replaceLazilyReadColumns(new_reading_columns, lazily_read_parts);
+
+    if (expression_step)
+    {
+        auto & dag = *expression_step->getExpression();
+        auto & outputs = dag.getOutputs();
+
+        std::erase_if(outputs, [&](const ActionsDAG::Node * output)
+        {
+            return output->type == ActionsDAG::ActionType::INPUT && lazy_names_set.contains(output->result_name);
+        });
+
+        dag.removeUnusedActions();
+
+        const auto & new_reading_header = reading_step->getOutputStream().header;
+        outputs.push_back(&dag.addInput(new_reading_header.getByName("_part_index")));
+        outputs.push_back(&dag.addInput(new_reading_header.getByName("_part_offset")));
+
+        expression_step->updateInputStream(reading_step->getOutputStream());
+    }
+
+    sorting_step->updateInputStream(sorting_node->children.front()->step->getOutputStream());
+    limit_step->updateInputStream(sorting_step->getOutputStream());
+
+    /// Put the original LIMIT into a new node and replace the current one
+    /// with a LazilyReadStep, so that the parent keeps pointing to the right place.
+    auto & new_limit_node = nodes.emplace_back();
+    new_limit_node.step = std::move(node.step);
+    new_limit_node.children = std::move(node.children);
+
+    node.children = {&new_limit_node};
+    node.step = std::make_unique<LazilyReadStep>(new_limit_node.step->getOutputStream(), original_header, std::move(lazy_column_reader));
+
+    return true;
+}
+
+}
+
+void optimizeLazyMaterialization(QueryPlan::Node & root, QueryPlan::Nodes & nodes, size_t max_limit_for_lazy_materialization)
+{
+    Stack stack;
+    stack.push_back({.node = &root});
+
+    while (!stack.empty())
+    {
+        auto & frame = stack.back();
+
+        if (frame.next_child == 0 && tryLazilyReadColumnsAfterLimit(*frame.node, nodes, max_limit_for_lazy_materialization))
+        {
+            /// The subtree was rewritten, there is nothing more to find in it.
+            stack.pop_back();
+            continue;
+        }
+
+        if (frame.next_child < frame.node->children.size())
+        {
+            auto next_frame = Frame{.node = frame.node->children[frame.next_child]};
+            ++frame.next_child;
+            stack.push_back(next_frame);
+            continue;
+        }
+
+        stack.pop_back();
+    }
+}
+
+}
+
+}
@@ -201,6 +201,9 @@ void optimizeTreeSecondPass(const QueryPlanOptimizationSettings & optimization_s
         stack.pop_back();
     }
 
+    if (optimization_settings.lazy_materialization)
+        optimizeLazyMaterialization(root, nodes, optimization_settings.max_limit_for_lazy_materialization);
+
     if (optimization_settings.force_use_projection && has_reading_from_mt && num_applied_projection == 0)
         throw Exception(
             ErrorCodes::PROJECTION_NOT_USED,
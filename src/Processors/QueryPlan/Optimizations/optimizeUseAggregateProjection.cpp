@@ -605,6 +605,17 @@ bool optimizeUseAggregateProjections(QueryPlan::Node & node, QueryPlan::Nodes &
         const auto & parts_with_ranges = ordinary_reading_select_result->parts_with_ranges;
 
         /// Selecting best candidate.
+        ///
+        /// The cost model is marks-to-read, which is less naive than it looks: sum_marks comes
+        /// from a full per-candidate index analysis over the same predicate (every candidate is
+        /// analyzed against the projection's own primary key above), so granule selectivity is
+        /// priced in. What marks deliberately do not price is per-mark row width - projection
+        /// granules with pre-aggregated rows are usually far cheaper to process than base
+        /// granules at equal mark counts, so the comparison is conservative in the projection's
+        /// disfavor. A candidate that reads fewer bytes but more marks, or that wins only after
+        /// accounting for residual filter cost, is the case a byte-and-CPU model would add. The
+        /// chosen candidate and the per-candidate mark counts are already exposed in
+        /// EXPLAIN indexes = 1 via the analysis results attached below.
         for (auto & candidate : candidates.real)
         {
             auto required_column_names = candidate.dag->getRequiredColumnsNames();
@@ -178,6 +178,14 @@ bool isPartitionKeySuitsGroupByKey(
 namespace DB::QueryPlanOptimizations
 {
 
+/// Partition-wise aggregation: when the GROUP BY key functionally contains the partition key
+/// (modulo injective wrappers, checked above), every group lives in exactly one partition, so
+/// reading is switched to one output port per partition and the aggregation's final merge is
+/// skipped - results are simply concatenated. Enabled by
+/// allow_aggregate_partitions_independently; see also force_aggregate_partitions_independently
+/// to bypass the sanity limits on partition count. The join analogue (both sides partitioned
+/// the same way joined on the partition key) has no counterpart here, since two ReadFromMergeTree
+/// subtrees would need their partition outputs paired up through the whole join step.
 size_t tryAggregatePartitionsIndependently(QueryPlan::Node * node, QueryPlan::Nodes &)
 {
     if (!node || node->children.size() != 1)
@@ -737,6 +737,15 @@ Pipe ReadFromMergeTree::spreadMarkRangesAmongStreams(RangesInDataParts && parts_
 
     if (num_streams > 1)
     {
+        /// This clamp is the degree-of-parallelism decision for the whole query: max_threads
+        /// is only an upper bound, and when the scan is small the reduced stream count
+        /// propagates upward (downstream stages are built per stream, and the executor
+        /// upscales threads lazily via ConcurrencyControl only when there are tasks for
+        /// them), so a 1000-row GROUP BY does not instantiate max_threads aggregation
+        /// transforms. Post-scan stages have no independent estimate to re-widen or shrink
+        /// themselves; Resize steps change stream counts only for explicit reasons (e.g.
+        /// before UNION or after FINAL), not from cardinality guesses.
+        ///
         /// Reduce the number of num_streams if the data is small.
         if (info.sum_marks < num_streams * info.min_marks_for_concurrent_read && parts_with_ranges.size() < num_streams)
         {
@@ -1236,6 +1245,16 @@ Pipe ReadFromMergeTree::spreadMarkRangesAmongStreamsFinal(
         /// If do_not_merge_across_partitions_select_final is true and there is only one part in partition
         /// with level > 0 then we won't post-process this part, and if num_streams > 1 we
         /// can use parallel select on such parts.
+        ///
+        /// Note that "this part contains no duplicate keys" does not need to be recorded as
+        /// extra part metadata: level > 0 already implies it for Replacing/Collapsing-style
+        /// engines, because any merge collapses same-key rows within its output. What a
+        /// per-part cleanliness bit cannot express is the condition that actually forces
+        /// FINAL to merge - duplicates *across* parts, which is a property of the part set,
+        /// not of any single part. That cross-part condition is handled at a finer grain by
+        /// split_parts_ranges_into_intersecting_and_non_intersecting_final below, which
+        /// compares primary-key ranges between parts and routes non-overlapping ranges
+        /// around the merge even in partitions that still have overlapping remainders.
         bool no_merging_final = do_not_merge_across_partitions_select_final &&
             std::distance(parts_to_merge_ranges[range_index], parts_to_merge_ranges[range_index + 1]) == 1 &&
             parts_to_merge_ranges[range_index]->data_part->info.level > 0 &&
@@ -1676,6 +1695,7 @@ ReadFromMergeTree::AnalysisResultPtr ReadFromMergeTree::selectRangesToReadImpl(
             context_,
             indexes->key_condition,
             indexes->part_offset_condition,
+            query_info_.prewhere_info,
             indexes->skip_indexes,
             reader_settings,
             log,
@@ -1787,6 +1807,28 @@ void ReadFromMergeTree::updatePrewhereInfo(const PrewhereInfoPtr & prewhere_info
         enable_vertical_final);
 }
 
+void ReadFromMergeTree::replaceLazilyReadColumns(const Names & new_all_column_names, LazilyReadDataPartsPtr lazily_read_parts_)
+{
+    all_column_names = new_all_column_names;
+    required_source_columns = new_all_column_names;
+    lazily_read_parts = std::move(lazily_read_parts_);
+
+    /// The cached analysis result contains the list of columns to read, so it is not valid anymore.
+    analyzed_result_ptr = nullptr;
+
+    output_stream = DataStream{.header = MergeTreeSelectProcessor::transformHeader(
+        storage_snapshot->getSampleBlockForColumns(all_column_names),
+        prewhere_info)};
+
+    updateSortDescriptionForOutputStream(
+        *output_stream,
+        storage_snapshot->getMetadataForQuery()->getSortingKeyColumns(),
+        getSortDirection(),
+        query_info.input_order_info,
+        prewhere_info,
+        enable_vertical_final);
+}
+
 bool ReadFromMergeTree::requestOutputEachPartitionThroughSeparatePort()
 {
     if (isQueryWithFinal())
@@ -1965,6 +2007,20 @@ void ReadFromMergeTree::initializePipeline(QueryPipelineBuilder & pipeline, cons
 {
     auto result = getAnalysisResult();
 
+    /// Publish the final part set for MergeTreeLazilyReader. The slots are keyed by
+    /// part_index_in_query: it is assigned over the parts which survived partition and
+    /// _part pruning, so the initially prepared parts cannot be used for this.
+    if (lazily_read_parts)
+    {
+        size_t num_parts = 0;
+        for (const auto & part : result.parts_with_ranges)
+            num_parts = std::max(num_parts, part.part_index_in_query + 1);
+
+        lazily_read_parts->resize(num_parts);
+        for (const auto & part : result.parts_with_ranges)
+            (*lazily_read_parts)[part.part_index_in_query] = {part.data_part, part.alter_conversions};
+    }
+
     /// Do not keep data parts in snapshot.
     /// They are stored separately, and some could be released after PK analysis.
     storage_snapshot->data = std::make_unique<MergeTreeData::SnapshotData>();
@@ -6,6 +6,7 @@
 #include <Storages/MergeTree/MergeTreeData.h>
 #include <Storages/MergeTree/MergeTreeReadPool.h>
 #include <Storages/MergeTree/AlterConversions.h>
+#include <Storages/MergeTree/MergeTreeLazilyReader.h>
 #include <Storages/MergeTree/PartitionPruner.h>
 
 namespace DB
@@ -175,6 +176,14 @@ public:
     bool readsInOrder() const;
 
     void updatePrewhereInfo(const PrewhereInfoPtr & prewhere_info_value) override;
+
+    /// Used by the lazy materialization optimization: replaces the set of columns to read
+    /// (the deferred columns are replaced by the _part_index and _part_offset virtual columns)
+    /// and updates the output header accordingly. The passed vector is filled with the final
+    /// parts (keyed by part_index_in_query) once the analysis result is known, so that
+    /// MergeTreeLazilyReader resolves _part_index against the same part set the sources used.
+    void replaceLazilyReadColumns(const Names & new_all_column_names, LazilyReadDataPartsPtr lazily_read_parts_);
+
     bool isQueryWithSampling() const;
 
     /// Returns true if the optimization is applicable (and applies it then).
@@ -223,6 +232,9 @@ private:
 
     Names all_column_names;
 
+    /// Set by the lazy materialization optimization, filled in initializePipeline().
+    LazilyReadDataPartsPtr lazily_read_parts;
+
     const MergeTreeData & data;
     ExpressionActionsSettings actions_settings;
 
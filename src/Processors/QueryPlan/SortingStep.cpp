@@ -35,6 +35,7 @@ SortingStep::Settings::Settings(const Context & context)
     max_bytes_before_remerge = settings.max_bytes_before_remerge_sort;
     remerge_lowered_memory_bytes_ratio = settings.remerge_sort_lowered_memory_bytes_ratio;
     max_bytes_before_external_sort = settings.max_bytes_before_external_sort;
+    compress_sort_blocks_in_memory = settings.compress_sort_blocks_in_memory;
     tmp_data = context.getTempDataOnDisk();
     min_free_disk_space = settings.min_free_disk_space_for_temporary_data;
 }
@@ -289,6 +290,7 @@ void SortingStep::mergeSorting(
                 sort_settings.max_bytes_before_remerge / pipeline.getNumStreams(),
                 sort_settings.remerge_lowered_memory_bytes_ratio,
                 sort_settings.max_bytes_before_external_sort,
+                sort_settings.compress_sort_blocks_in_memory,
                 std::move(tmp_data_on_disk),
                 sort_settings.min_free_disk_space);
         });
@@ -25,6 +25,7 @@ public:
         size_t max_bytes_before_remerge = 0;
         double remerge_lowered_memory_bytes_ratio = 0;
         size_t max_bytes_before_external_sort = 0;
+        bool compress_sort_blocks_in_memory = false;
         TemporaryDataOnDiskScopePtr tmp_data = nullptr;
         size_t min_free_disk_space = 0;
 
@@ -62,6 +62,16 @@ WindowStep::WindowStep(
 
 void WindowStep::transformPipeline(QueryPipelineBuilder & pipeline, const BuildQueryPipelineSettings &)
 {
+    /// Partition-parallel execution happens here, if only implicitly. When the window has
+    /// PARTITION BY, the preceding SortingStep scatters rows across `threads` streams by
+    /// partition key hash and sorts each stream locally (scatterByPartitionIfNeeded), so the
+    /// addSimpleTransform below instantiates one WindowTransform per stream, each seeing
+    /// whole partitions. One WindowTransform still processes its partitions serially - the
+    /// parallelism is across streams, which is why skew in PARTITION BY values maps directly
+    /// to skew across cores. Frames without PARTITION BY are inherently sequential (every
+    /// row's frame can span the whole data set) and collapse to one stream above. Per-stream
+    /// sorts spill through the regular MergeSortingTransform machinery, so spill support
+    /// comes for free from the sort, not from this step.
     auto num_threads = pipeline.getNumThreads();
 
     // This resize is needed for cases such as `over ()` when we don't have a
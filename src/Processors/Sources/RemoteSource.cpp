@@ -68,6 +68,13 @@ ISource::Status RemoteSource::prepare()
         return Status::Finished;
     }
 
+    /// Async here means the remote read is a first-class awaitable of the executor: the fd
+    /// from readAsync()/sendQueryAsync() goes into the executor's polling queue (epoll) and
+    /// this processor holds no thread and no task slot until the socket is ready - the fiber
+    /// in RemoteQueryExecutorReadContext only packages the protocol state so the read can be
+    /// suspended at a packet boundary. Wide fan-outs therefore wait at the cost of one epoll
+    /// registration per stream, provided async_socket_for_remote / async_query_sending_for_remote
+    /// stay enabled; with them off, reads fall back to blocking a pipeline thread per stream.
     if (is_async_state)
         return Status::Async;
 
@@ -44,6 +44,7 @@ TTLAggregationAlgorithm::TTLAggregationAlgorithm(
         settings.enable_software_prefetch_in_aggregation,
         /*only_merge=*/ false,
         settings.optimize_group_by_constant_keys,
+        /*enable_adaptive_partial_aggregation_bypass=*/ false,
         settings.min_chunk_bytes_for_parallel_parsing,
         /*stats_collecting_params=*/ {});
 
@@ -14,6 +14,12 @@ TTLDeleteAlgorithm::TTLDeleteAlgorithm(
         new_ttl_info.ttl_finished = true;
 }
 
+/// Expired rows are dropped here, at merge time, and deliberately not at query time. Using
+/// per-part ttl_infos min/max to hide fully-expired granules from SELECT would make query
+/// results depend on the wall clock and diverge between replicas that merged at different
+/// moments; the contract is that TTL frees data eventually while reads stay deterministic
+/// against the current part set. ttl_only_drop_parts is the supported way to make expiry
+/// coarse and cheap (whole parts are dropped without rewriting when part max TTL passed).
 void TTLDeleteAlgorithm::execute(Block & block)
 {
     if (!block || !isMinTTLExpired())
@@ -22,34 +28,35 @@ void TTLDeleteAlgorithm::execute(Block & block)
     auto ttl_column = executeExpressionAndGetColumn(ttl_expressions.expression, block, description.result_column);
     auto where_column = executeExpressionAndGetColumn(ttl_expressions.where_expression, block, description.where_result_column);
 
-    MutableColumns result_columns;
-    const auto & column_names = block.getNames();
+    size_t rows = block.rows();
 
-    result_columns.reserve(column_names.size());
-    for (auto it = column_names.begin(); it != column_names.end(); ++it)
+    /// Decide the fate of every row once, then filter all columns with the vectorized
+    /// IColumn::filter instead of copying rows one by one per column.
+    IColumn::Filter keep_filter(rows);
+    size_t rows_kept = 0;
+
+    for (size_t i = 0; i < rows; ++i)
     {
-        const IColumn * values_column = block.getByName(*it).column.get();
-        MutableColumnPtr result_column = values_column->cloneEmpty();
-        result_column->reserve(block.rows());
+        UInt32 cur_ttl = getTimestampByIndex(ttl_column.get(), i);
+        bool where_filter_passed = !where_column || where_column->getBool(i);
 
-        for (size_t i = 0; i < block.rows(); ++i)
-        {
-            UInt32 cur_ttl = getTimestampByIndex(ttl_column.get(), i);
-            bool where_filter_passed = !where_column || where_column->getBool(i);
+        bool keep = !isTTLExpired(cur_ttl) || !where_filter_passed;
+        keep_filter[i] = keep;
 
-            if (!isTTLExpired(cur_ttl) || !where_filter_passed)
-            {
-                new_ttl_info.update(cur_ttl);
-                result_column->insertFrom(*values_column, i);
-            }
-            else if (it == column_names.begin())
-                ++rows_removed;
+        if (keep)
+        {
+            new_ttl_info.update(cur_ttl);
+            ++rows_kept;
         }
-
-        result_columns.emplace_back(std::move(result_column));
+        else
+            ++rows_removed;
     }
 
-    block = block.cloneWithColumns(std::move(result_columns));
+    if (rows_kept == rows)
+        return;
+
+    for (auto & column_with_type : block)
+        column_with_type.column = column_with_type.column->filter(keep_filter, rows_kept);
 }
 
 void TTLDeleteAlgorithm::finalize(const MutableDataPartPtr & data_part) const
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <atomic>
 #include <Processors/Transforms/AggregatingTransform.h>
 
@@ -42,6 +43,11 @@ Chunk convertToChunk(const Block & block)
 
 namespace
 {
+    /// Sample this many rows before deciding whether partial aggregation actually collapses anything.
+    constexpr UInt64 bypass_sample_rows = 100000;
+    /// Bypass partial aggregation only if at least this fraction of the sampled rows produced a unique key.
+    constexpr double bypass_min_unique_keys_ratio = 0.9;
+
     const AggregatedChunkInfo * getInfoFromChunk(const Chunk & chunk)
     {
         const auto & info = chunk.getChunkInfo();
@@ -100,10 +106,18 @@ public:
         std::array<std::atomic<bool>, NUM_BUCKETS> is_bucket_processed{};
         std::atomic<bool> is_cancelled = false;
 
+        /// Buckets are taken by the workers in this order. Filled with the largest buckets first
+        /// before the sources are created, so that with skewed data the most expensive bucket
+        /// does not start last and bound the duration of the whole merge.
+        std::array<UInt32, NUM_BUCKETS> bucket_order;
+
         SharedData()
         {
             for (auto & flag : is_bucket_processed)
                 flag = false;
+
+            for (UInt32 i = 0; i < NUM_BUCKETS; ++i)
+                bucket_order[i] = i;
         }
     };
 
@@ -124,14 +138,16 @@ public:
 protected:
     Chunk generate() override
     {
-        UInt32 bucket_num = shared_data->next_bucket_to_merge.fetch_add(1);
+        UInt32 merge_index = shared_data->next_bucket_to_merge.fetch_add(1);
 
-        if (bucket_num >= NUM_BUCKETS)
+        if (merge_index >= NUM_BUCKETS)
         {
             data.reset();
             return {};
         }
 
+        UInt32 bucket_num = shared_data->bucket_order[merge_index];
+
         Block block = params->aggregator.mergeAndConvertOneBucketToBlock(*data, arena, params->final, bucket_num, shared_data->is_cancelled);
         Chunk chunk = convertToChunk(block);
 
@@ -280,16 +296,23 @@ private:
 /// ConvertingAggregatedToChunksWithMergingSource -> ConvertingAggregatedToChunksTransform -> AggregatingTransform
 /// ConvertingAggregatedToChunksWithMergingSource ->
 ///
-/// Result chunks guaranteed to be sorted by bucket number.
+/// If produce_in_order_of_bucket_number is set, result chunks are guaranteed to be sorted by bucket number.
+/// Otherwise chunks are pushed as soon as they are merged, and the largest buckets are merged first,
+/// so that with skewed data the merge is not bounded by the hottest bucket starting last.
 class ConvertingAggregatedToChunksTransform : public IProcessor
 {
 public:
-    ConvertingAggregatedToChunksTransform(AggregatingTransformParamsPtr params_, ManyAggregatedDataVariantsPtr data_, size_t num_threads_)
+    ConvertingAggregatedToChunksTransform(
+        AggregatingTransformParamsPtr params_,
+        ManyAggregatedDataVariantsPtr data_,
+        size_t num_threads_,
+        bool produce_in_order_of_bucket_number_)
         : IProcessor({}, {params_->getHeader()})
         , params(std::move(params_))
         , data(std::move(data_))
         , shared_data(std::make_shared<ConvertingAggregatedToChunksWithMergingSource::SharedData>())
         , num_threads(num_threads_)
+        , produce_in_order_of_bucket_number(produce_in_order_of_bucket_number_)
     {
     }
 
@@ -410,11 +433,34 @@ private:
             if (!input.isFinished() && input.hasData())
             {
                 auto chunk = input.pull();
-                auto bucket = getInfoFromChunk(chunk)->bucket_num;
-                two_level_chunks[bucket] = std::move(chunk);
+                if (produce_in_order_of_bucket_number)
+                {
+                    auto bucket = getInfoFromChunk(chunk)->bucket_num;
+                    two_level_chunks[bucket] = std::move(chunk);
+                }
+                else if (chunk.hasRows())
+                    completed_two_level_chunks.emplace_back(std::move(chunk));
             }
         }
 
+        if (!produce_in_order_of_bucket_number)
+        {
+            if (!completed_two_level_chunks.empty())
+            {
+                auto chunk = std::move(completed_two_level_chunks.front());
+                completed_two_level_chunks.erase(completed_two_level_chunks.begin());
+                output.push(std::move(chunk));
+                return Status::PortFull;
+            }
+
+            for (const auto & input : inputs)
+                if (!input.isFinished())
+                    return Status::NeedData;
+
+            output.finish();
+            return Status::Finished;
+        }
+
         while (current_bucket_num < NUM_BUCKETS)
         {
             if (!shared_data->is_bucket_processed[current_bucket_num])
@@ -444,6 +490,7 @@ private:
     ConvertingAggregatedToChunksWithMergingSource::SharedDataPtr shared_data;
 
     size_t num_threads;
+    const bool produce_in_order_of_bucket_number;
 
     bool is_initialized = false;
     bool finished = false;
@@ -453,6 +500,8 @@ private:
     UInt32 current_bucket_num = 0;
     static constexpr Int32 NUM_BUCKETS = 256;
     std::array<Chunk, NUM_BUCKETS> two_level_chunks;
+    /// Merged buckets waiting to be pushed when the output order does not matter.
+    Chunks completed_two_level_chunks;
 
     Processors processors;
 
@@ -516,6 +565,19 @@ private:
         AggregatedDataVariantsPtr & first = data->at(0);
         processors.reserve(num_threads);
 
+        /// With skewed GROUP BY the merge duration is bounded by the largest bucket, so hand out
+        /// the buckets to the workers in decreasing order of size. Only when the output order does
+        /// not matter: otherwise almost the whole result would have to be buffered while waiting
+        /// for the lowest bucket numbers to be merged last.
+        if (!produce_in_order_of_bucket_number && num_threads > 1)
+        {
+            auto sizes = params->aggregator.bucketSizes(*data);
+            std::stable_sort(
+                shared_data->bucket_order.begin(),
+                shared_data->bucket_order.end(),
+                [&](UInt32 lhs, UInt32 rhs) { return sizes[lhs] > sizes[rhs]; });
+        }
+
         for (size_t thread = 0; thread < num_threads; ++thread)
         {
             /// Select Arena to avoid race conditions
@@ -588,6 +650,14 @@ IProcessor::Status AggregatingTransform::prepare()
         return Status::PortFull;
     }
 
+    /// In bypass mode chunks aggregated on their own are sent downstream right away.
+    if (!bypass_chunks.empty())
+    {
+        output.push(std::move(bypass_chunks.front()));
+        bypass_chunks.erase(bypass_chunks.begin());
+        return Status::PortFull;
+    }
+
     /// Finish data processing, prepare to generating.
     if (is_consume_finished && !is_generate_initialized.test())
     {
@@ -695,10 +765,52 @@ void AggregatingTransform::consume(Chunk chunk)
         if (!params->aggregator.mergeOnBlock(block, variants, no_more_keys, is_cancelled))
             is_consume_finished = true;
     }
+    else if (bypass_partial_aggregation)
+    {
+        if (num_rows == 0)
+            return;
+
+        /// Aggregate the chunk on its own: duplicate keys inside the chunk still collapse,
+        /// but the result is sent downstream to the merge stage right away (see prepare())
+        /// instead of being accumulated in the shared hash table.
+        AggregatedDataVariants chunk_variants;
+        bool chunk_no_more_keys = false;
+        if (!params->aggregator.executeOnBlock(
+                chunk.detachColumns(), 0, num_rows, chunk_variants, key_columns, aggregate_columns, chunk_no_more_keys))
+            is_consume_finished = true;
+
+        for (auto & block : params->aggregator.convertToBlocks(chunk_variants, /* final */ false, /* max_threads */ 1))
+            bypass_chunks.emplace_back(convertToChunk(block));
+    }
     else
     {
         if (!params->aggregator.executeOnBlock(chunk.detachColumns(), 0, num_rows, variants, key_columns, aggregate_columns, no_more_keys))
             is_consume_finished = true;
+        else if (params->params.enable_adaptive_partial_aggregation_bypass && !bypass_decided && src_rows >= bypass_sample_rows)
+        {
+            bypass_decided = true;
+
+            /// Bypass is only sound when a merge stage follows and will see all the chunks:
+            /// not for the final step, not when rows can be dropped by max_rows_to_group_by,
+            /// not when downstream relies on bucket ordering (memory bound merging)
+            /// and not when part of the state has already been spilled to disk.
+            size_t unique_keys = variants.sizeWithoutOverflowRow();
+            if (!params->final
+                && !no_more_keys
+                && params->params.keys_size > 0
+                && params->params.max_rows_to_group_by == 0
+                && !should_produce_results_in_order_of_bucket_number
+                && !params->aggregator.hasTemporaryData()
+                && unique_keys >= bypass_min_unique_keys_ratio * src_rows)
+            {
+                bypass_partial_aggregation = true;
+                LOG_TRACE(
+                    log,
+                    "Almost all keys are unique ({} out of {} rows), partial aggregation is bypassed",
+                    unique_keys,
+                    src_rows);
+            }
+        }
     }
 }
 
@@ -749,8 +861,8 @@ void AggregatingTransform::initGenerate()
         {
             auto prepared_data = params->aggregator.prepareVariantsToMerge(std::move(many_data->variants));
             auto prepared_data_ptr = std::make_shared<ManyAggregatedDataVariants>(std::move(prepared_data));
-            processors.emplace_back(
-                std::make_shared<ConvertingAggregatedToChunksTransform>(params, std::move(prepared_data_ptr), max_threads));
+            processors.emplace_back(std::make_shared<ConvertingAggregatedToChunksTransform>(
+                params, std::move(prepared_data_ptr), max_threads, should_produce_results_in_order_of_bucket_number));
         }
         else
         {
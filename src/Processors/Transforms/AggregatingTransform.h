@@ -188,6 +188,14 @@ private:
      */
     bool no_more_keys = false;
 
+    /** Adaptive bypass of partial aggregation (see consume()).
+     *  After sampling the first rows, if almost every key is unique, further chunks are aggregated
+     *   each on its own and immediately pushed to the output instead of being accumulated in `variants`.
+     */
+    bool bypass_decided = false;
+    bool bypass_partial_aggregation = false;
+    Chunks bypass_chunks;
+
     ManyAggregatedDataPtr many_data;
     AggregatedDataVariants & variants;
     size_t max_threads = 1;
@@ -33,6 +33,15 @@ ArrayJoinTransform::ArrayJoinTransform(
 
 void ArrayJoinTransform::consume(Chunk chunk)
 {
+    /// The replication blow-up of large arrays is contained in two places rather than by
+    /// fusing this transform with its consumer. Upstream, the plan optimizer pushes filter
+    /// conjuncts that don't touch the unnested columns below the ARRAY JOIN step, so rows are
+    /// discarded before their arrays are expanded. Here, the result iterator emits the
+    /// expansion incrementally in max_block_size slices - a 10K-element array never
+    /// materializes as one replicated mega-block, only as a stream of bounded chunks that the
+    /// downstream filter consumes one at a time. A fused expand-filter-aggregate kernel would
+    /// save allocating those bounded chunks, but it would need codegen over arbitrary
+    /// downstream expressions; the replicate() call on offsets is the cheap part.
     auto block = getInputPort().getHeader().cloneWithColumns(chunk.detachColumns());
     result_iterator = array_join->execute(block);
 }
@@ -30,13 +30,15 @@ JoiningTransform::JoiningTransform(
     size_t max_block_size_,
     bool on_totals_,
     bool default_totals_,
-    FinishCounterPtr finish_counter_)
+    FinishCounterPtr finish_counter_,
+    size_t read_ahead_bytes_)
     : IProcessor({input_header}, {output_header})
     , join(std::move(join_))
     , on_totals(on_totals_)
     , default_totals(default_totals_)
     , finish_counter(std::move(finish_counter_))
     , max_block_size(max_block_size_)
+    , read_ahead_bytes(read_ahead_bytes_)
 {
     if (!join->isFilled())
         inputs.emplace_back(Block(), this); // Wait for FillingRightJoinSideTransform
@@ -90,6 +92,26 @@ IProcessor::Status JoiningTransform::prepare()
             if (last_in.hasData())
                 throw Exception(ErrorCodes::LOGICAL_ERROR, "No data is expected from second JoiningTransform port");
 
+            /// While the right side is being filled, read ahead a bounded amount of data from
+            /// the left input, so the left-side scan starts (and warms up its prefetching)
+            /// concurrently with the build instead of strictly after it.
+            if (read_ahead_bytes && !on_totals)
+            {
+                auto & main_input = inputs.front();
+                if (!main_input.isFinished() && read_ahead_chunks_bytes < read_ahead_bytes)
+                {
+                    main_input.setNeeded();
+                    if (main_input.hasData())
+                    {
+                        auto chunk = main_input.pull(true);
+                        read_ahead_chunks_bytes += chunk.allocatedBytes();
+                        read_ahead_chunks.push_back(std::move(chunk));
+                    }
+                }
+                else
+                    main_input.setNotNeeded();
+            }
+
             return Status::NeedData;
         }
     }
@@ -97,6 +119,15 @@ IProcessor::Status JoiningTransform::prepare()
     if (has_input)
         return Status::Ready;
 
+    if (!read_ahead_chunks.empty())
+    {
+        input_chunk = std::move(read_ahead_chunks.front());
+        read_ahead_chunks.pop_front();
+        read_ahead_chunks_bytes -= std::min(read_ahead_chunks_bytes, input_chunk.allocatedBytes());
+        has_input = true;
+        return Status::Ready;
+    }
+
     auto & input = inputs.front();
     if (input.isFinished())
     {
@@ -293,6 +324,8 @@ IProcessor::Status FillingRightJoinSideTransform::prepare()
         return Status::Ready;
     }
 
+    join->onBuildFinished();
+
     output.finish();
     return Status::Finished;
 }
@@ -1,6 +1,8 @@
 #pragma once
 #include <Processors/IProcessor.h>
 
+#include <deque>
+
 
 namespace DB
 {
@@ -47,7 +49,8 @@ public:
         size_t max_block_size_,
         bool on_totals_ = false,
         bool default_totals_ = false,
-        FinishCounterPtr finish_counter_ = nullptr);
+        FinishCounterPtr finish_counter_ = nullptr,
+        size_t read_ahead_bytes_ = 0);
 
     ~JoiningTransform() override;
 
@@ -85,6 +88,11 @@ private:
     IBlocksStreamPtr non_joined_blocks;
     size_t max_block_size;
 
+    /// Chunks read from the left input ahead of time, while the right side is still being filled.
+    std::deque<Chunk> read_ahead_chunks;
+    size_t read_ahead_chunks_bytes = 0;
+    const size_t read_ahead_bytes;
+
     Block readExecute(Chunk & chunk);
 };
 
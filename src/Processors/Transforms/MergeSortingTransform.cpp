@@ -85,12 +85,14 @@ MergeSortingTransform::MergeSortingTransform(
     size_t max_bytes_before_remerge_,
     double remerge_lowered_memory_bytes_ratio_,
     size_t max_bytes_before_external_sort_,
+    bool compress_blocks_in_memory_,
     TemporaryDataOnDiskPtr tmp_data_,
     size_t min_free_disk_space_)
     : SortingTransform(header, description_, max_merged_block_size_, limit_, increase_sort_description_compile_attempts)
     , max_bytes_before_remerge(max_bytes_before_remerge_)
     , remerge_lowered_memory_bytes_ratio(remerge_lowered_memory_bytes_ratio_)
     , max_bytes_before_external_sort(max_bytes_before_external_sort_)
+    , compress_blocks_in_memory(compress_blocks_in_memory_)
     , tmp_data(std::move(tmp_data_))
     , min_free_disk_space(min_free_disk_space_)
 {
@@ -144,8 +146,18 @@ void MergeSortingTransform::consume(Chunk chunk)
 
     removeConstColumns(chunk);
 
+    /** Accumulated blocks may live for a long time (until the whole stream is consumed),
+      * so keeping them compressed lowers the memory footprint of the accumulation phase.
+      * The spill and remerge thresholds below are still checked against the uncompressed
+      * size: MergeSorter decompresses all chunks up front (the k-way merge needs every
+      * cursor resident), so that is the peak which merging will actually reach.
+      */
+    size_t chunk_bytes = chunk.allocatedBytes();
+    if (compress_blocks_in_memory)
+        compressChunk(chunk);
+
     sum_rows_in_blocks += chunk.getNumRows();
-    sum_bytes_in_blocks += chunk.allocatedBytes();
+    sum_bytes_in_blocks += chunk_bytes;
     chunks.push_back(std::move(chunk));
 
     /** If significant amount of data was accumulated, perform preliminary merging step.
@@ -163,6 +175,16 @@ void MergeSortingTransform::consume(Chunk chunk)
     /** If too many of them and if external sorting is enabled,
       *  will merge blocks that we have in memory at this moment and write merged stream to temporary (compressed) file.
       * NOTE. It's possible to check free space in filesystem.
+      *
+      * The threshold is a static per-operator setting rather than an allotment from a
+      * query-wide broker. Such a broker (spilling operators register with the query
+      * MemoryTracker and an arbiter orders who spills as the query limit nears) keeps
+      * running into the same constraint: spilling is only safe at a block boundary on the
+      * operator's own thread, while the memory limit is discovered inside an arbitrary
+      * allocation on an arbitrary thread - the arbiter could only request a spill and wait,
+      * which is the OvercommitTracker pattern, and that waits on query kill, not operator
+      * spill. Until operators expose such a cooperative spill point, the budget split across
+      * sort/aggregation/join stays manual via the max_bytes_before_external_* settings.
       */
     if (max_bytes_before_external_sort && sum_bytes_in_blocks > max_bytes_before_external_sort)
     {
@@ -254,8 +276,13 @@ void MergeSortingTransform::remerge()
 
     while (auto chunk = remerge_sorter.read())
     {
+        /// As in consume(), the accounted size is the uncompressed one.
         new_sum_rows_in_blocks += chunk.getNumRows();
         new_sum_bytes_in_blocks += chunk.allocatedBytes();
+
+        if (compress_blocks_in_memory)
+            compressChunk(chunk);
+
         new_chunks.emplace_back(std::move(chunk));
     }
 
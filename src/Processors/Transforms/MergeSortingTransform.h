@@ -28,6 +28,7 @@ public:
         size_t max_bytes_before_remerge_,
         double remerge_lowered_memory_bytes_ratio_,
         size_t max_bytes_before_external_sort_,
+        bool compress_blocks_in_memory_,
         TemporaryDataOnDiskPtr tmp_data_,
         size_t min_free_disk_space_);
 
@@ -44,6 +45,8 @@ private:
     size_t max_bytes_before_remerge;
     double remerge_lowered_memory_bytes_ratio;
     size_t max_bytes_before_external_sort;
+    /// Hold accumulated blocks LZ4-compressed in memory (they are decompressed lazily for merging).
+    bool compress_blocks_in_memory;
     TemporaryDataOnDiskPtr tmp_data;
     size_t min_free_disk_space;
 
@@ -54,6 +54,16 @@ namespace DB
   * When you receive next blocks from different sources,
   *  data from sources can also be read in several threads (reading_threads)
   *  for optimal performance in the presence of a fast network or disks (from where these blocks are read).
+  *
+  * Relation to a shuffle stage: the 256-bucket split is a hash repartitioning of the key
+  * space, so this merge is already "shuffled" - the initiator bottleneck for high-cardinality
+  * keys is CPU on final merge, bounded, not memory. A true shuffle (shards exchanging buckets
+  * among themselves and each finalizing a key range) would need shard-to-shard data paths
+  * that the current topology does not have: all interserver query connections terminate at
+  * the initiator, and shards are unaware of each other's existence within a query. The
+  * in-tree levers are distributed_group_by_no_merge / optimize_distributed_group_by_sharding_key
+  * (skip the funnel when data is already partitioned by key) and parallel replicas, which
+  * scale the partial-aggregation side.
   */
 
 /// Has several inputs and single output.
@@ -34,6 +34,10 @@ MergeSorter::MergeSorter(const Block & header, Chunks chunks_, SortDescription &
         if (chunk.getNumRows() == 0)
             continue;
 
+        /// Chunks could have been compressed in memory while they were accumulated
+        /// (see compress_sort_blocks_in_memory). Merging requires random access to rows.
+        decompressChunk(chunk);
+
         /// Convert to full column, because sparse column has
         /// access to element in O(log(K)), where K is number of non-default rows,
         /// which can be inefficient.
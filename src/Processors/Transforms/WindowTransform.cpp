@@ -341,6 +341,25 @@ WindowTransform::WindowTransform(const Block & input_header_,
         workspaces.push_back(std::move(workspace));
     }
 
+    // If the frame start can move inside a partition, the aggregation states are
+    // maintained with the two-stacks algorithm, which needs one more state per
+    // workspace for the back accumulator.
+    frame_is_sliding
+        = window_description.frame.begin_type != WindowFrame::BoundaryType::Unbounded;
+    if (frame_is_sliding)
+    {
+        for (auto & ws : workspaces)
+        {
+            if (ws.window_function_impl)
+                continue;
+
+            ws.back_state.reset(
+                ws.aggregate_function->sizeOfData(),
+                ws.aggregate_function->alignOfData());
+            ws.aggregate_function->create(ws.back_state.data());
+        }
+    }
+
     partition_by_indices.reserve(window_description.partition_by.size());
     for (const auto & column : window_description.partition_by)
     {
@@ -411,6 +430,12 @@ WindowTransform::~WindowTransform()
     {
         ws.aggregate_function->destroy(
             ws.aggregate_function_state.data());
+
+        for (auto & state : ws.front_states)
+            ws.aggregate_function->destroy(state.data());
+
+        if (ws.back_state.data())
+            ws.aggregate_function->destroy(ws.back_state.data());
     }
 }
 
@@ -957,6 +982,12 @@ void WindowTransform::updateAggregationState()
     assert(partition_start <= frame_start);
     assert(frame_end <= partition_end);
 
+    if (frame_is_sliding)
+    {
+        updateAggregationStateTwoStacks();
+        return;
+    }
+
     // We might have to reset aggregation state and/or add some rows to it.
     // Figure out what to do.
     bool reset_aggregation = false;
@@ -972,9 +1003,10 @@ void WindowTransform::updateAggregationState()
     else
     {
         // The frame start changed, reset the state and aggregate over the
-        // entire frame. This can be made per-function after we learn to
-        // subtract rows from some types of aggregation states, but for now we
-        // always have to reset when the frame start changes.
+        // entire frame. Frames whose start can move inside a partition are
+        // handled incrementally by the two-stacks path above, so with the
+        // UNBOUNDED PRECEDING start this is not expected to happen, but it is
+        // kept as a correct fallback.
         reset_aggregation = true;
         rows_to_add_start = frame_start;
         rows_to_add_end = frame_end;
@@ -997,44 +1029,216 @@ void WindowTransform::updateAggregationState()
             a->create(buf);
         }
 
-        // To achieve better performance, we will have to loop over blocks and
-        // rows manually, instead of using advanceRowNumber().
-        // For this purpose, the past-the-end block can be different than the
-        // block of the past-the-end row (it's usually the next block).
-        const auto past_the_end_block = rows_to_add_end.row == 0
-            ? rows_to_add_end.block
-            : rows_to_add_end.block + 1;
+        addRowsToAggregationState(ws, buf, rows_to_add_start, rows_to_add_end);
+    }
+}
+
+void WindowTransform::addRowsToAggregationState(WindowFunctionWorkspace & ws,
+    AggregateDataPtr place, RowNumber rows_to_add_start, RowNumber rows_to_add_end)
+{
+    const auto * a = ws.aggregate_function.get();
+
+    // To achieve better performance, we will have to loop over blocks and
+    // rows manually, instead of using advanceRowNumber().
+    // For this purpose, the past-the-end block can be different than the
+    // block of the past-the-end row (it's usually the next block).
+    const auto past_the_end_block = rows_to_add_end.row == 0
+        ? rows_to_add_end.block
+        : rows_to_add_end.block + 1;
+
+    for (auto block_number = rows_to_add_start.block;
+         block_number < past_the_end_block;
+         ++block_number)
+    {
+        auto & block = blockAt(block_number);
 
-        for (auto block_number = rows_to_add_start.block;
-             block_number < past_the_end_block;
-             ++block_number)
+        if (ws.cached_block_number != block_number)
         {
-            auto & block = blockAt(block_number);
+            for (size_t i = 0; i < ws.argument_column_indices.size(); ++i)
+            {
+                ws.argument_columns[i] = block.input_columns[
+                    ws.argument_column_indices[i]].get();
+            }
+            ws.cached_block_number = block_number;
+        }
 
-            if (ws.cached_block_number != block_number)
+        // First and last blocks may be processed partially, and other blocks
+        // are processed in full.
+        const auto first_row = block_number == rows_to_add_start.block
+            ? rows_to_add_start.row : 0;
+        const auto past_the_end_row = block_number == rows_to_add_end.block
+            ? rows_to_add_end.row : block.rows;
+
+        // We should add an addBatch analog that can accept a starting offset.
+        // For now, add the values one by one.
+        auto * columns = ws.argument_columns.data();
+        // Removing arena.get() from the loop makes it faster somehow...
+        auto * arena_ptr = arena.get();
+        a->addBatchSinglePlace(first_row, past_the_end_row, place, columns, arena_ptr);
+    }
+}
+
+// Destroy the `count` topmost front states of the workspace, keeping their
+// buffers for reuse. Each popped state removes the earliest remaining front row.
+void WindowTransform::popFrontStates(WindowFunctionWorkspace & ws, size_t count)
+{
+    assert(count <= ws.front_states.size());
+
+    const auto * a = ws.aggregate_function.get();
+    for (size_t i = 0; i < count; ++i)
+    {
+        a->destroy(ws.front_states.back().data());
+        ws.spare_state_buffers.push_back(std::move(ws.front_states.back()));
+        ws.front_states.pop_back();
+    }
+}
+
+// Rebuild the front stack of the workspace from the rows accumulated in the
+// back state. The state built for a row aggregates this row and everything
+// after it, so the top of the stack covers all of them and popping a state
+// removes the earliest remaining row. The back state is reset.
+void WindowTransform::rebuildFrontStates(WindowFunctionWorkspace & ws)
+{
+    assert(ws.front_states.empty());
+
+    const auto * a = ws.aggregate_function.get();
+    auto * arena_ptr = arena.get();
+
+    ws.front_states.reserve(back_rows.size());
+    for (size_t i = back_rows.size(); i > 0; --i)
+    {
+        const auto & row = back_rows[i - 1];
+
+        if (ws.spare_state_buffers.empty())
+            ws.spare_state_buffers.emplace_back(a->sizeOfData(), a->alignOfData());
+
+        AlignedBuffer state_buffer(std::move(ws.spare_state_buffers.back()));
+        ws.spare_state_buffers.pop_back();
+
+        auto * place = state_buffer.data();
+        a->create(place);
+
+        try
+        {
+            if (ws.cached_block_number != row.block)
             {
-                for (size_t i = 0; i < ws.argument_column_indices.size(); ++i)
-                {
-                    ws.argument_columns[i] = block.input_columns[
-                        ws.argument_column_indices[i]].get();
-                }
-                ws.cached_block_number = block_number;
+                const auto & input_columns = inputAt(row);
+                for (size_t j = 0; j < ws.argument_column_indices.size(); ++j)
+                    ws.argument_columns[j] = input_columns[ws.argument_column_indices[j]].get();
+                ws.cached_block_number = row.block;
             }
 
-            // First and last blocks may be processed partially, and other blocks
-            // are processed in full.
-            const auto first_row = block_number == rows_to_add_start.block
-                ? rows_to_add_start.row : 0;
-            const auto past_the_end_row = block_number == rows_to_add_end.block
-                ? rows_to_add_end.row : block.rows;
+            // The row is added before the rest of the suffix is merged in, to
+            // keep the rows in frame order for order-dependent functions such
+            // as groupArray.
+            a->add(place, ws.argument_columns.data(), row.row, arena_ptr);
 
-            // We should add an addBatch analog that can accept a starting offset.
-            // For now, add the values one by one.
-            auto * columns = ws.argument_columns.data();
-            // Removing arena.get() from the loop makes it faster somehow...
-            auto * arena_ptr = arena.get();
-            a->addBatchSinglePlace(first_row, past_the_end_row, buf, columns, arena_ptr);
+            if (!ws.front_states.empty())
+                a->merge(place, ws.front_states.back().data(), arena_ptr);
         }
+        catch (...)
+        {
+            a->destroy(place);
+            throw;
+        }
+
+        ws.front_states.push_back(std::move(state_buffer));
+    }
+
+    // The back state now represents no rows.
+    a->destroy(ws.back_state.data());
+    a->create(ws.back_state.data());
+}
+
+// Update the aggregation states for a sliding frame with the two-stacks
+// algorithm. The rows of the frame are split between the front stacks of the
+// workspaces (the earliest rows, represented by suffix-aggregated states) and
+// the shared back_rows (the latest ones, accumulated into the back states), so
+// the aggregate over the whole frame is merge(front top, back). A row enters
+// the frame with a single add() into the back state; when a row has to leave
+// and the front stack is empty, the stack is rebuilt from the back rows, which
+// makes removal O(1) amortized while using only add() and merge().
+void WindowTransform::updateAggregationStateTwoStacks()
+{
+    if (frame_start >= prev_frame_end)
+    {
+        // The new frame does not intersect the previous one (this includes the
+        // first frame of a partition), drop all accumulated rows and start over.
+        for (auto & ws : workspaces)
+        {
+            if (ws.window_function_impl)
+                continue;
+
+            popFrontStates(ws, ws.front_states.size());
+
+            const auto * a = ws.aggregate_function.get();
+            a->destroy(ws.back_state.data());
+            a->create(ws.back_state.data());
+        }
+
+        front_rows = 0;
+        back_rows.clear();
+    }
+    else if (frame_start != prev_frame_start)
+    {
+        // Pop the rows which left the frame. A rebuild can happen at most once
+        // here: it moves all the back rows to the front stacks, and nothing is
+        // pushed until the popping is done.
+        size_t rows_to_pop = 0;
+        for (auto row = prev_frame_start; row < frame_start; advanceRowNumber(row))
+            ++rows_to_pop;
+
+        assert(rows_to_pop <= front_rows + back_rows.size());
+        const bool need_rebuild = rows_to_pop > front_rows;
+        const size_t pops_after_rebuild = need_rebuild ? rows_to_pop - front_rows : 0;
+
+        for (auto & ws : workspaces)
+        {
+            if (ws.window_function_impl)
+                continue;
+
+            popFrontStates(ws, std::min(rows_to_pop, ws.front_states.size()));
+
+            if (need_rebuild)
+            {
+                rebuildFrontStates(ws);
+                popFrontStates(ws, pops_after_rebuild);
+            }
+        }
+
+        if (need_rebuild)
+        {
+            front_rows = back_rows.size() - pops_after_rebuild;
+            back_rows.clear();
+        }
+        else
+            front_rows -= rows_to_pop;
+    }
+
+    // Push the rows which entered the frame into the back states.
+    const auto rows_to_add_start = std::max(frame_start, prev_frame_end);
+    for (auto row = rows_to_add_start; row < frame_end; advanceRowNumber(row))
+        back_rows.push_back(row);
+
+    for (auto & ws : workspaces)
+    {
+        if (ws.window_function_impl)
+            continue;
+
+        addRowsToAggregationState(ws, ws.back_state.data(), rows_to_add_start, frame_end);
+
+        // Materialize the aggregate over the whole frame for writeOutCurrentRow().
+        // The front rows are the earliest ones, so they are merged first.
+        const auto * a = ws.aggregate_function.get();
+        auto * buf = ws.aggregate_function_state.data();
+
+        a->destroy(buf);
+        a->create(buf);
+
+        if (!ws.front_states.empty())
+            a->merge(buf, ws.front_states.back().data(), arena.get());
+        if (!back_rows.empty())
+            a->merge(buf, ws.back_state.data(), arena.get());
     }
 }
 
@@ -1312,8 +1516,17 @@ void WindowTransform::appendChunk(Chunk & chunk)
             auto * buf = ws.aggregate_function_state.data();
 
             a->destroy(buf);
+
+            // The two-stacks states may reference the arena as well,
+            // so they have to be destroyed before it is released.
+            popFrontStates(ws, ws.front_states.size());
+            if (frame_is_sliding)
+                a->destroy(ws.back_state.data());
         }
 
+        back_rows.clear();
+        front_rows = 0;
+
         // Release the arena we use for aggregate function states, so that it
         // doesn't grow without limit. Not sure if it's actually correct, maybe
         // it allocates the return values in the Arena as well...
@@ -1333,6 +1546,9 @@ void WindowTransform::appendChunk(Chunk & chunk)
             auto * buf = ws.aggregate_function_state.data();
 
             a->create(buf);
+
+            if (frame_is_sliding)
+                a->create(ws.back_state.data());
         }
     }
 }
@@ -41,6 +41,18 @@ struct WindowFunctionWorkspace
     // Will not be initialized for a pure window function.
     mutable AlignedBuffer aggregate_function_state;
 
+    // Two-stacks evaluation of sliding frames, see
+    // WindowTransform::updateAggregationStateTwoStacks(). Only initialized for
+    // aggregate functions over a frame whose start can move. The top of
+    // front_states (the last element) aggregates all the front rows of the
+    // frame and every state below it a suffix of them; back_state accumulates
+    // the rows which entered the frame after the last rebuild. Every buffer in
+    // front_states holds a created state.
+    std::vector<AlignedBuffer> front_states;
+    // Buffers of popped front states, kept for reuse.
+    std::vector<AlignedBuffer> spare_state_buffers;
+    AlignedBuffer back_state;
+
     // Argument columns. Be careful, this is a per-block cache.
     std::vector<const IColumn *> argument_columns;
     UInt64 cached_block_number = std::numeric_limits<UInt64>::max();
@@ -124,6 +136,11 @@ public:
     void advanceFrameEndRangeOffset();
 
     void updateAggregationState();
+    void updateAggregationStateTwoStacks();
+    void rebuildFrontStates(WindowFunctionWorkspace & ws);
+    void popFrontStates(WindowFunctionWorkspace & ws, size_t count);
+    void addRowsToAggregationState(WindowFunctionWorkspace & ws,
+        AggregateDataPtr place, RowNumber rows_to_add_start, RowNumber rows_to_add_end);
     void writeOutCurrentRow();
 
     Columns & inputAt(const RowNumber & x)
@@ -336,6 +353,17 @@ public:
     RowNumber prev_frame_start;
     RowNumber prev_frame_end;
 
+    // Whether the frame start can move inside a partition, in which case the
+    // aggregation states are maintained by updateAggregationStateTwoStacks().
+    bool frame_is_sliding = false;
+
+    // For the two-stacks evaluation of sliding frames: the rows accumulated in
+    // the back states of the workspaces, in the order they entered the frame,
+    // and the number of rows represented by the front stacks. Shared by all
+    // workspaces because they all see the same frame.
+    std::vector<RowNumber> back_rows;
+    size_t front_rows = 0;
+
     // Comparison function for RANGE OFFSET frames. We choose the appropriate
     // overload once, based on the type of the ORDER BY column. Choosing it for
     // each row would be slow.
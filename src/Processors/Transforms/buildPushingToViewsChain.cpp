@@ -86,6 +86,16 @@ struct ViewsData
 using ViewsDataPtr = std::shared_ptr<ViewsData>;
 
 /// Copies data inserted into table for every dependent table.
+///
+/// The "copy" is a COW clone - every view branch receives the same immutable columns, so
+/// fan-out to 12 views shares one set of source bytes. Whether the branches then execute
+/// serially or concurrently is not decided here: with parallel_view_processing the chain gets
+/// up to min(max_threads, num_views) threads and branches run in parallel; without it they
+/// share one thread and interleave per chunk. Per-view micro-batching also already exists -
+/// each branch squashes both before the inner query (when the target storage wants it) and
+/// after it (SquashingChunksTransform below), so small source blocks do not translate into
+/// per-view small parts. If ingest runs far below raw-table speed with many views, the first
+/// knobs are parallel_view_processing and min_insert_block_size_rows_for_materialized_views.
 class CopyingDataToViewsTransform final : public IProcessor
 {
 public:
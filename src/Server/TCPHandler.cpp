@@ -2049,6 +2049,15 @@ void TCPHandler::initBlockOutput(const Block & block)
         const Settings & query_settings = query_context->getSettingsRef();
         if (!state.maybe_compressed_out)
         {
+            /// Wire compression is fixed per query, but not per server: since
+            /// network_compression_method / network_zstd_compression_level are query settings,
+            /// LAN-vs-WAN asymmetry is handled by profiles on the respective users or per
+            /// DDL in cluster configuration, not by one global value. Mid-stream adaptation
+            /// would be wire-compatible already - every compressed frame carries its own
+            /// method byte, so the codec may legally change between blocks - the missing part
+            /// is a feedback signal: socket backpressure is only visible as blocked writes
+            /// in the poll loop, and reacting to it from here would couple the query thread
+            /// to transport state that Poco does not expose portably.
             std::string method = Poco::toUpper(query_settings.network_compression_method.toString());
             std::optional<int> level;
             if (method == "ZSTD")
@@ -2168,6 +2177,16 @@ QueryState::CancellationStatus TCPHandler::getQueryCancellationStatus()
 }
 
 
+/// A "zero-copy" result path that would splice storage-compressed frames straight onto the
+/// socket for trivial SELECT * queries does not fit the formats involved. On disk each column
+/// lives in its own file and its compressed frames are aligned to granule boundaries; the
+/// Native wire format interleaves per-column type headers and data inside a single block, with
+/// column order and subset chosen by the query header. There is no point where the bytes on
+/// disk and the bytes on the wire would coincide, so frames cannot be forwarded as-is. On top
+/// of that, by the time a chunk reaches here it is a set of decompressed IColumns with no
+/// provenance back to the disk frames it came from. The practical lever for bulk export is to
+/// make the wire codec cheap (network_compression_method = LZ4, or NONE over fast links) so
+/// the re-compression leg costs little, rather than to bypass it.
 void TCPHandler::sendData(const Block & block)
 {
     initBlockOutput(block);
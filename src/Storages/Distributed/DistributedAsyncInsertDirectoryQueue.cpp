@@ -411,6 +411,14 @@ void DistributedAsyncInsertDirectoryQueue::processFile(std::string & file_path,
         Settings insert_settings = distributed_header.insert_settings;
         insert_settings.applyChanges(settings_changes);
 
+        /// The entry comes from a keep-alive pool, so bursts are not paying TCP/TLS setup per
+        /// file - what is serial here is the protocol: one INSERT occupies the connection
+        /// until its ack, and the native protocol has no channel concept to interleave
+        /// several inserts with pipelined acks on one socket. Concurrency comes from the
+        /// per-shard queues instead, and within one queue ordering is part of the contract
+        /// (files are sent in creation order), so the throughput knobs are batching
+        /// (distributed_background_insert_batch merges many files into one INSERT) and the
+        /// schedule pool size, not extra sockets per shard.
         auto timeouts = ConnectionTimeouts::getTCPTimeoutsWithFailover(insert_settings);
         auto result = pool->getManyCheckedForInsert(timeouts, insert_settings, PoolMode::GET_ONE, storage.remote_storage.getQualifiedName());
         auto connection = std::move(result.front().entry);
@@ -138,6 +138,17 @@ Chunk KafkaSource::generateImpl()
         }
     };
 
+    /// Parsing stays on the consumer thread on purpose, even though ParallelParsingInputFormat
+    /// could chew raw batches faster. Each message contributes per-row virtual columns
+    /// (_topic/_partition/_offset/_timestamp) and per-message error rows, which requires
+    /// knowing exactly which rows came from which message - information that survives only
+    /// while parsing is interleaved with consume(). Offset commits depend on the same mapping:
+    /// we commit precisely the offsets whose rows made it into the delivered block. Handing
+    /// batches to parallel parsers would need that bookkeeping rebuilt across threads for a
+    /// stage that is rarely the bottleneck - scaling here is by partitions via
+    /// kafka_num_consumers (plus kafka_thread_per_consumer), and rebalance behaviour is
+    /// librdkafka's, so cooperative-sticky assignment is enabled through the <kafka> config
+    /// section (partition.assignment.strategy) rather than in this code.
     StreamingFormatExecutor executor(non_virtual_header, input_format, std::move(on_error));
 
     while (true)
@@ -41,6 +41,10 @@ private:
     using Base = CacheBase<UInt128, MarksInCompressedFile, UInt128TrivialHash, MarksWeightFunction>;
 
 public:
+    /// Many concurrent queries read marks of the same hot parts, so the cache is sharded
+    /// to avoid serializing all lookups on a single mutex.
+    static constexpr size_t NUM_SHARDS = 16;
+
     MarkCache(const String & cache_policy, size_t max_size_in_bytes, double size_ratio);
 
     /// Calculate key from path to file and offset.
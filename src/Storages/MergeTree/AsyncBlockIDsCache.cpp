@@ -30,6 +30,16 @@ struct AsyncBlockIDsCache<TStorage>::Cache : public std::unordered_set<String>
     {}
 };
 
+/// Periodically mirrors the async-insert block-id list from Keeper so commitPart can filter
+/// obvious duplicates before attempting the multi-op; Keeper remains the source of truth and
+/// this cache is only an optimistic pre-check. Moving dedup state out of Keeper into the
+/// parts themselves (rolling token windows shipped as part metadata) trades that central
+/// arbiter away: two replicas ingesting the same token concurrently would each commit a part
+/// and discover the collision only after replication, when un-inserting is no longer an
+/// option. Dedup must be decided before the part becomes visible, and the only cluster-wide
+/// point that can decide it atomically is the same Keeper transaction that commits the part -
+/// which is why the scaling lever here is fewer, larger flushes (bigger async_insert windows)
+/// rather than a cheaper per-flush protocol.
 template <typename TStorage>
 void AsyncBlockIDsCache<TStorage>::update()
 try
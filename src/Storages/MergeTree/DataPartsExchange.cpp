@@ -296,6 +296,12 @@ MergeTreeData::DataPart::Checksums Service::sendPartFromDisk(
         writeStringBinary(file_name, out);
         writeBinary(desc.file_size, out);
 
+        /// The copy goes through userspace on purpose, even for local-disk parts where
+        /// sendfile() would be tempting: every streamed byte must pass through the hashing
+        /// buffer so the sender can verify the file against the part checksums below (the
+        /// protection against silent disk corruption spreading to replicas), and the stream is
+        /// subject to the sends throttler, the cancellation blocker and HTTP chunked framing -
+        /// none of which survive an in-kernel file-to-socket copy.
         auto file_in = desc.input_buffer_getter();
         HashingWriteBuffer hashing_out(out);
         copyDataWithThrottler(*file_in, hashing_out, blocker.getCounter(), data.getSendsThrottler());
@@ -384,6 +390,15 @@ Fetcher::Fetcher(StorageReplicatedMergeTree & data_)
     , log(getLogger(data.getStorageID().getNameForLogs() + " (Fetcher)"))
 {}
 
+/// A part is fetched over a single HTTP stream; parallelism in re-replication comes from
+/// fetching many parts concurrently (background_fetches_pool_size), which saturates links in
+/// the common many-parts case. Splitting one part across ranged streams would break the
+/// protocol's integrity model - files arrive as one verified sequence (see sendPartFromDisk)
+/// and are committed as a whole directory. Delta transfer keyed on per-file checksums of a
+/// covered ancestor part is theoretically attractive but rarely applicable: merges rewrite
+/// every column file (rows are interleaved across the merged range), so ancestor and merged
+/// part share checksums only for trivial move-like merges; the cases where blobs genuinely
+/// coincide are exactly what zero-copy replication already covers on shared storage.
 std::pair<MergeTreeData::MutableDataPartPtr, scope_guard> Fetcher::fetchSelectedPart(
     const StorageMetadataPtr & metadata_snapshot,
     ContextPtr context,
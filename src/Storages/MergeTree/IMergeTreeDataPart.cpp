@@ -11,6 +11,7 @@
 #include <Core/NamesAndTypes.h>
 #include <Core/SettingsEnums.h>
 #include <DataTypes/DataTypeAggregateFunction.h>
+#include <DataTypes/DataTypeLowCardinality.h>
 #include <DataTypes/NestedUtils.h>
 #include <IO/HashingReadBuffer.h>
 #include <IO/HashingWriteBuffer.h>
@@ -898,6 +899,32 @@ void IMergeTreeDataPart::loadIndex() const
             }
         }
 
+        /// Dictionary-encode String key columns whose values mostly repeat between adjacent marks
+        /// (typical for wide string keys: the index stores one row per granule of sorted data,
+        /// so consecutive granules often start with the same key value).
+        if (storage.getSettings()->primary_key_compress_strings_in_memory)
+        {
+            for (size_t j = 0; j < key_size; ++j)
+            {
+                if (!isString(primary_key.data_types[j]))
+                    continue;
+
+                size_t num_changes = 0;
+                for (size_t i = 1; i < marks_count; ++i)
+                    if (0 != loaded_index[j]->compareAt(i, i - 1, *loaded_index[j], 0))
+                        ++num_changes;
+
+                /// The dictionary stores the unique values plus the reverse index,
+                /// so encoding pays off only when at least half of the adjacent values are equal.
+                if (num_changes * 2 >= marks_count)
+                    continue;
+
+                auto lc_column = DataTypeLowCardinality(primary_key.data_types[j]).createColumn();
+                lc_column->insertRangeFrom(*loaded_index[j], 0, marks_count);
+                loaded_index[j] = std::move(lc_column);
+            }
+        }
+
         for (size_t i = 0; i < key_size; ++i)
         {
             loaded_index[i]->shrinkToFit();
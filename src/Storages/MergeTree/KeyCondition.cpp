@@ -1386,6 +1386,15 @@ private:
 };
 
 
+/// Chains of monotonic functions around the key (including binary arithmetic with one
+/// constant argument, so `ts + INTERVAL x` qualifies) are handled without symbolic
+/// inversion: the chain is recorded and later applied FORWARD to the mark-range boundary
+/// values, and monotonicity alone guarantees the transformed range brackets the predicate's
+/// answer. Inverting the chain to rewrite the predicate would be strictly weaker - inverses
+/// do not exist for the non-strict monotonic functions (toStartOfHour and friends) that
+/// dominate real predicates. What actually makes an atom fall out of this path is a step
+/// whose monotonicity getMonotonicityForRange() cannot confirm for an unknown range, or a
+/// function of several non-constant arguments.
 bool KeyCondition::isKeyPossiblyWrappedByMonotonicFunctions(
     const RPNBuilderTreeNode & node,
     size_t & out_key_column_num,
@@ -456,8 +456,22 @@ bool MergeTask::ExecuteAndFinalizeHorizontalPart::execute()
 bool MergeTask::ExecuteAndFinalizeHorizontalPart::executeImpl()
 {
     Block block;
-    if (!ctx->is_cancelled() && (global_ctx->merging_executor->pull(block)))
+    bool pulled = false;
+    if (!ctx->is_cancelled())
     {
+        if (global_ctx->parallel_merging_executor)
+            pulled = global_ctx->parallel_merging_executor->pull(block);
+        else
+            pulled = global_ctx->merging_executor->pull(block);
+    }
+
+    if (pulled)
+    {
+        /// The asynchronous executor may return an empty block if the pipeline
+        /// finished while we were waiting for the next one.
+        if (!block)
+            return true;
+
         global_ctx->rows_written += block.rows();
 
         const_cast<MergedBlockOutputStream &>(*global_ctx->to).write(block);
@@ -485,6 +499,7 @@ bool MergeTask::ExecuteAndFinalizeHorizontalPart::executeImpl()
     }
 
     global_ctx->merging_executor.reset();
+    global_ctx->parallel_merging_executor.reset();
     global_ctx->merged_pipeline.reset();
 
     if (global_ctx->merges_blocker->isCancelled() || global_ctx->merge_list_element_ptr->is_cancelled.load(std::memory_order_relaxed))
@@ -765,6 +780,11 @@ bool MergeTask::MergeProjectionsStage::mergeMinMaxIndexAndPrepareProjections() c
         // projection_future_part->path = global_ctx->future_part->path + "/" + projection.name + ".proj/";
         projection_future_part->part_info = {"all", 0, 0, 0};
 
+        /// Projections are maintained incrementally: instead of rebuilding them from the merged
+        /// data, the projection parts of the source parts (which are MergeTree parts themselves)
+        /// are merged directly. For aggregate projections the Aggregating mode combines the
+        /// partial aggregation states of rows with equal keys, so the result is the same as if
+        /// the projection was recalculated over the merged part.
         MergeTreeData::MergingParams projection_merging_params;
         projection_merging_params.mode = MergeTreeData::MergingParams::Ordinary;
         if (projection.type == ProjectionDescription::Type::Aggregate)
@@ -921,6 +941,13 @@ void MergeTask::ExecuteAndFinalizeHorizontalPart::createMergedStream()
 
     /// We count total amount of bytes in parts
     /// and use direct_io + aio if there is more than min_merge_bytes_to_use_direct_io
+    ///
+    /// Only reads bypass the page cache; the written part goes through it. O_DIRECT writes
+    /// would require every write() to be aligned in offset, length and memory, while
+    /// CompressedWriteBuffer produces variable-size frames - padding them to the alignment
+    /// would change the on-disk format. The write side is also what makes the result of the
+    /// merge immediately readable from cache, which matters for parts that are queried
+    /// right after they appear.
     ctx->read_with_direct_io = false;
     const auto data_settings = global_ctx->data->getSettings();
     if (data_settings->min_merge_bytes_to_use_direct_io != 0)
@@ -1127,13 +1154,26 @@ void MergeTask::ExecuteAndFinalizeHorizontalPart::createMergedStream()
     if (!subqueries.empty())
         builder = addCreatingSetsTransform(std::move(builder), std::move(subqueries), global_ctx->context);
 
+    /// By default the whole merge pipeline is executed on the thread of the merge task itself.
+    /// With merge_max_threads > 1 it is executed by a pool of threads, so the source parts are
+    /// read and decompressed concurrently with each other and with merging and writing the
+    /// result. More threads than one per source part plus one for the merging transform and
+    /// the rest of the pipeline cannot be utilized.
+    const size_t num_merge_threads = std::min<size_t>(
+        data_settings->merge_max_threads, global_ctx->future_part->parts.size() + 1);
+    if (num_merge_threads > 1)
+        builder->setMaxThreads(num_merge_threads);
+
     global_ctx->merged_pipeline = QueryPipelineBuilder::getPipeline(std::move(*builder));
     /// Dereference unique_ptr and pass horizontal_stage_progress by reference
     global_ctx->merged_pipeline.setProgressCallback(MergeProgressCallback(global_ctx->merge_list_element_ptr, global_ctx->watch_prev_elapsed, *global_ctx->horizontal_stage_progress));
     /// Is calculated inside MergeProgressCallback.
     global_ctx->merged_pipeline.disableProfileEventUpdate();
 
-    global_ctx->merging_executor = std::make_unique<PullingPipelineExecutor>(global_ctx->merged_pipeline);
+    if (num_merge_threads > 1)
+        global_ctx->parallel_merging_executor = std::make_unique<PullingAsyncPipelineExecutor>(global_ctx->merged_pipeline);
+    else
+        global_ctx->merging_executor = std::make_unique<PullingPipelineExecutor>(global_ctx->merged_pipeline);
 }
 
 
@@ -10,6 +10,7 @@
 
 #include <Interpreters/TemporaryDataOnDisk.h>
 
+#include <Processors/Executors/PullingAsyncPipelineExecutor.h>
 #include <Processors/Executors/PullingPipelineExecutor.h>
 #include <Processors/Transforms/ColumnGathererTransform.h>
 
@@ -179,6 +180,9 @@ private:
         std::shared_ptr<MergedBlockOutputStream> to{nullptr};
         QueryPipeline merged_pipeline;
         std::unique_ptr<PullingPipelineExecutor> merging_executor;
+        /// Used instead of `merging_executor` when the merge pipeline is executed by several
+        /// threads (see the `merge_max_threads` merge tree setting).
+        std::unique_ptr<PullingAsyncPipelineExecutor> parallel_merging_executor;
 
         MergeTreeData::MutableDataPartPtr new_data_part{nullptr};
 
@@ -9,6 +9,14 @@
 #include <Common/noexcept_scope.h>
 #include <Common/logger_useful.h>
 
+namespace ProfileEvents
+{
+    extern const Event MergeMutateBackgroundExecutorQueueWaitMicroseconds;
+    extern const Event MoveBackgroundExecutorQueueWaitMicroseconds;
+    extern const Event FetchBackgroundExecutorQueueWaitMicroseconds;
+    extern const Event CommonBackgroundExecutorQueueWaitMicroseconds;
+}
+
 
 namespace CurrentMetrics
 {
@@ -26,6 +34,25 @@ namespace ErrorCodes
     extern const int INVALID_CONFIG_PARAMETER;
 }
 
+namespace
+{
+
+ProfileEvents::Event queueWaitEventForExecutor(const String & name)
+{
+    if (name == "MergeMutate")
+        return ProfileEvents::MergeMutateBackgroundExecutorQueueWaitMicroseconds;
+    if (name == "Move")
+        return ProfileEvents::MoveBackgroundExecutorQueueWaitMicroseconds;
+    if (name == "Fetch")
+        return ProfileEvents::FetchBackgroundExecutorQueueWaitMicroseconds;
+    if (name == "Common")
+        return ProfileEvents::CommonBackgroundExecutorQueueWaitMicroseconds;
+    /// Executors with other names exist only in unit tests.
+    return ProfileEvents::end();
+}
+
+}
+
 
 template <class Queue>
 MergeTreeBackgroundExecutor<Queue>::MergeTreeBackgroundExecutor(
@@ -40,6 +67,7 @@ MergeTreeBackgroundExecutor<Queue>::MergeTreeBackgroundExecutor(
     , max_tasks_count(max_tasks_count_)
     , metric(metric_)
     , max_tasks_metric(max_tasks_metric_, 2 * max_tasks_count) // active + pending
+    , queue_wait_event(queueWaitEventForExecutor(name))
     , pool(std::make_unique<ThreadPool>(
           CurrentMetrics::MergeTreeBackgroundExecutorThreads, CurrentMetrics::MergeTreeBackgroundExecutorThreadsActive, CurrentMetrics::MergeTreeBackgroundExecutorThreadsScheduled))
 {
@@ -244,6 +272,7 @@ void MergeTreeBackgroundExecutor<Queue>::routine(TaskRuntimeDataPtr item)
         /// Not to own the object it points to.
         /// Otherwise the destruction of the task won't be ordered with the destruction of the
         /// storage.
+        item_->pending_watch.restart();
         pending.push(std::move(item_));
         has_tasks.notify_one();
     };
@@ -343,6 +372,9 @@ void MergeTreeBackgroundExecutor<Queue>::threadFunction()
 
                 item = std::move(pending.pop());
                 active.push_back(item);
+
+                if (queue_wait_event != ProfileEvents::end())
+                    ProfileEvents::increment(queue_wait_event, item->pending_watch.elapsedMicroseconds());
             }
 
             routine(std::move(item));
@@ -17,6 +17,7 @@
 #include <base/defines.h>
 #include <Common/CurrentMetrics.h>
 #include <Common/Exception.h>
+#include <Common/ProfileEvents.h>
 #include <Common/Stopwatch.h>
 #include <Common/ThreadPool_fwd.h>
 
@@ -65,6 +66,9 @@ struct TaskRuntimeData
     /// This is equal to task->getPriority() not to do useless virtual calls in comparator
     Priority priority;
 
+    /// Time of the last enqueueing into the pending queue, to account how long the task waited for a thread.
+    Stopwatch pending_watch;
+
     /// By default priority queue will have max element at top
     static bool comparePtrByPriority(const TaskRuntimeDataPtr & lhs, const TaskRuntimeDataPtr & rhs)
     {
@@ -294,6 +298,8 @@ private:
     std::atomic<size_t> max_tasks_count = 0;
     CurrentMetrics::Metric metric;
     CurrentMetrics::Increment max_tasks_metric;
+    /// Resolved from `name` in the constructor; counts the time tasks spent in the pending queue.
+    ProfileEvents::Event queue_wait_event;
 
     void routine(TaskRuntimeDataPtr item);
 
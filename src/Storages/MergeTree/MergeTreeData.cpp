@@ -11,6 +11,7 @@
 #include <Common/Config/ConfigHelper.h>
 #include <Common/CurrentMetrics.h>
 #include <Common/Increment.h>
+#include <Common/MemoryTrackerBlockerInThread.h>
 #include <Common/ProfileEventsScope.h>
 #include <Common/SimpleIncrement.h>
 #include <Common/Stopwatch.h>
@@ -1573,6 +1574,17 @@ std::vector<MergeTreeData::LoadPartResult> MergeTreeData::loadDataPartsFromDisk(
 }
 
 
+/// Part discovery reads each part's own small metadata files rather than a per-table
+/// manifest, and that is a considered position. The directory *is* the commit protocol:
+/// a part becomes active by rename, crash recovery classifies tmp_/broken/duplicate parts
+/// from what is actually on disk, and detach/attach, manual part moves and replica repair
+/// all work because every part is self-describing. A columnar manifest updated from
+/// MergeTree Transaction commits would be a second source of truth that must be kept
+/// crash-consistent with those renames - desynchronization turns into silently missing or
+/// phantom parts, the worst failure mode this storage has. The costs the manifest targets
+/// are attacked elsewhere instead: loading is parallel (max_part_loading_threads), Outdated
+/// parts load lazily in the background after startup, and on object storage the per-part
+/// reads the manifest would save are already batched by metadata files local to the disk.
 void MergeTreeData::loadDataParts(bool skip_sanity_checks, std::optional<std::unordered_set<std::string>> expected_parts)
 {
     LOG_DEBUG(log, "Loading data parts");
@@ -1655,6 +1667,12 @@ void MergeTreeData::loadDataParts(bool skip_sanity_checks, std::optional<std::un
         }
     }
 
+    /// Loading is deliberately two-phase (list everything, then load): which parts are active
+    /// is decided by building PartLoadingTree over the *complete* set of names, because a part
+    /// is skipped if a later-listed part covers it. Streaming listing pages straight into
+    /// part-metadata loading would start deserializing parts that the rest of the listing then
+    /// proves to be covered. So the listing itself is what gets parallelized (one task per
+    /// disk below, and the object storage iterators page asynchronously underneath).
     std::vector<PartLoadingTree::PartLoadingInfos> parts_to_load_by_disk(disks.size());
 
     ThreadPoolCallbackRunnerLocal<void> runner(getActivePartsLoadingThreadPool().get(), "ActiveParts");
@@ -1837,6 +1855,11 @@ void MergeTreeData::loadDataParts(bool skip_sanity_checks, std::optional<std::un
             [this] { loadOutdatedDataParts(/*is_async=*/ true); });
     }
 
+    if (settings->primary_key_lazy_load && settings->primary_key_preload_in_background)
+        primary_index_preload_task = getContext()->getSchedulePool().createTask(
+            "MergeTreeData::preloadPrimaryIndexes",
+            [this] { preloadPrimaryIndexes(); });
+
     LOG_DEBUG(log, "Loaded data parts ({} items)", data_parts_indexes.size());
     data_parts_loading_finished = true;
 }
@@ -1976,6 +1999,52 @@ void MergeTreeData::waitForOutdatedPartsToBeLoaded() const TSA_NO_THREAD_SAFETY_
     LOG_TRACE(log, "Finished waiting for outdated data parts to be loaded");
 }
 
+void MergeTreeData::preloadPrimaryIndexes()
+try
+{
+    /// Acquire shared lock because the task works with the loaded parts.
+    TableLockHolder shared_lock = lockForShare(RWLockImpl::NO_QUERY, getSettings()->lock_acquire_timeout_for_background_operations);
+
+    auto parts = getDataPartsVectorForInternalUsage();
+    LOG_DEBUG(log, "Preloading primary indexes of {} active data parts", parts.size());
+
+    /// Memory for the primary index is shared between queries and does not belong
+    /// to the current background task (the same is done on table initialization).
+    MemoryTrackerBlockerInThread temporarily_disable_memory_tracker;
+
+    ThreadPoolCallbackRunnerLocal<void> runner(getActivePartsLoadingThreadPool().get(), "PKPreload");
+
+    for (const auto & part : parts)
+    {
+        if (primary_index_preload_canceled)
+            break;
+
+        runner([my_part = part] { my_part->getIndex(); }, Priority{});
+    }
+
+    runner.waitForAllToFinishAndRethrowFirstError();
+}
+catch (...)
+{
+    /// The preload is an optimization, the indexes will be loaded lazily on first use anyway.
+    tryLogCurrentException(log, "while preloading primary indexes");
+}
+
+void MergeTreeData::startPrimaryIndexPreloadTask()
+{
+    if (primary_index_preload_task)
+        primary_index_preload_task->activateAndSchedule();
+}
+
+void MergeTreeData::stopPrimaryIndexPreloadTask()
+{
+    if (!primary_index_preload_task)
+        return;
+
+    primary_index_preload_canceled = true;
+    primary_index_preload_task->deactivate();
+}
+
 void MergeTreeData::startOutdatedDataPartsLoadingTask()
 {
     if (outdated_data_parts_loading_task)
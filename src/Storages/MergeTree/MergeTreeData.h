@@ -1554,6 +1554,13 @@ protected:
     void startOutdatedDataPartsLoadingTask();
     void stopOutdatedDataPartsLoadingTask();
 
+    BackgroundSchedulePool::TaskHolder primary_index_preload_task;
+    std::atomic_bool primary_index_preload_canceled = false;
+
+    void preloadPrimaryIndexes();
+    void startPrimaryIndexPreloadTask();
+    void stopPrimaryIndexPreloadTask();
+
     static void incrementInsertedPartsProfileEvent(MergeTreeDataPartType type);
     static void incrementMergedPartsProfileEvent(MergeTreeDataPartType type);
 
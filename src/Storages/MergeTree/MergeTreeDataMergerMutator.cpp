@@ -4,6 +4,7 @@
 #include <Storages/MergeTree/MergedColumnOnlyOutputStream.h>
 #include <Storages/MergeTree/SimpleMergeSelector.h>
 #include <Storages/MergeTree/AllMergeSelector.h>
+#include <Storages/MergeTree/LevelMergeSelector.h>
 #include <Storages/MergeTree/TTLMergeSelector.h>
 #include <Storages/MergeTree/MergeList.h>
 #include <Storages/MergeTree/MergeTreeDataWriter.h>
@@ -480,6 +481,12 @@ SelectPartsDecision MergeTreeDataMergerMutator::selectPartsToMergeFromRanges(
                 future_part->merge_type = MergeType::TTLDelete;
         }
 
+        /// Recompression tiering: parts whose rows all passed a RECOMPRESS TTL are rewritten in
+        /// the background with the codec from the TTL expression (e.g. hot data on LZ4, data
+        /// older than a month on ZSTD(9)). Age of the TTL column is the measure of coldness -
+        /// the server does not track per-part read frequency. The per-partition timeout
+        /// (merge_with_recompression_ttl_timeout) acts as hysteresis, so a partition is not
+        /// recompressed more often than once per timeout even as parts keep expiring.
         if (parts_to_merge.empty() && metadata_snapshot->hasAnyRecompressionTTL())
         {
             TTLRecompressMergeSelector recompress_ttl_selector(
@@ -497,17 +504,31 @@ SelectPartsDecision MergeTreeDataMergerMutator::selectPartsToMergeFromRanges(
 
     if (parts_to_merge.empty())
     {
-        SimpleMergeSelector::Settings merge_settings;
-        /// Override value from table settings
-        merge_settings.max_parts_to_merge_at_once = data_settings->max_parts_to_merge_at_once;
-        if (!data_settings->min_age_to_force_merge_on_partition_only)
-            merge_settings.min_age_to_force_merge = data_settings->min_age_to_force_merge_seconds;
+        /// OPTIMIZE queries must be able to merge everything down to one part,
+        /// so they always use the simple selector in the aggressive mode.
+        if (data_settings->merge_selector_algorithm == MergeSelectorAlgorithm::Level && !aggressive)
+        {
+            LevelMergeSelector::Settings merge_settings;
+            if (data_settings->max_parts_to_merge_at_once)
+                merge_settings.parts_to_merge = std::max<size_t>(2, std::min<size_t>(merge_settings.parts_to_merge, data_settings->max_parts_to_merge_at_once));
+
+            parts_to_merge = LevelMergeSelector(merge_settings)
+                                .select(parts_ranges, max_total_size_to_merge);
+        }
+        else
+        {
+            SimpleMergeSelector::Settings merge_settings;
+            /// Override value from table settings
+            merge_settings.max_parts_to_merge_at_once = data_settings->max_parts_to_merge_at_once;
+            if (!data_settings->min_age_to_force_merge_on_partition_only)
+                merge_settings.min_age_to_force_merge = data_settings->min_age_to_force_merge_seconds;
 
-        if (aggressive)
-            merge_settings.base = 1;
+            if (aggressive)
+                merge_settings.base = 1;
 
-        parts_to_merge = SimpleMergeSelector(merge_settings)
-                            .select(parts_ranges, max_total_size_to_merge);
+            parts_to_merge = SimpleMergeSelector(merge_settings)
+                                .select(parts_ranges, max_total_size_to_merge);
+        }
 
         /// Do not allow to "merge" part with itself for regular merges, unless it is a TTL-merge where it is ok to remove some values with expired ttl
         if (parts_to_merge.size() == 1)
@@ -10,6 +10,7 @@
 #include <Storages/MergeTree/MergeTreeDataPartUUID.h>
 #include <Storages/MergeTree/StorageFromMergeTreeDataPart.h>
 #include <Storages/MergeTree/MergeTreeIndexInverted.h>
+#include <Storages/MergeTree/PrewhereSelectivityCache.h>
 #include <Storages/ReadInOrderOptimizer.h>
 #include <Storages/VirtualColumnUtils.h>
 #include <Parsers/ASTIdentifier.h>
@@ -580,6 +581,30 @@ void MergeTreeDataSelectExecutor::filterPartsByPartition(
     }
 }
 
+/// Exclude granules which are known (from a previous execution of the same condition over the
+/// same immutable part) to contain no matching rows. Ranges are split around the excluded marks.
+static MarkRanges filterMarksUsingSelectivityCache(const MarkRanges & ranges, const std::vector<bool> & failing_marks)
+{
+    MarkRanges res;
+    for (const auto & range : ranges)
+    {
+        size_t begin = range.begin;
+        for (size_t mark = range.begin; mark < range.end; ++mark)
+        {
+            if (mark < failing_marks.size() && failing_marks[mark])
+            {
+                if (mark > begin)
+                    res.emplace_back(begin, mark);
+                begin = mark + 1;
+            }
+        }
+
+        if (range.end > begin)
+            res.emplace_back(begin, range.end);
+    }
+    return res;
+}
+
 RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipIndexes(
     MergeTreeData::DataPartsVector && parts,
     std::vector<AlterConversionsPtr> && alter_conversions,
@@ -587,6 +612,7 @@ RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipInd
     const ContextPtr & context,
     const KeyCondition & key_condition,
     const std::optional<KeyCondition> & part_offset_condition,
+    const PrewhereInfoPtr & prewhere_info,
     const UsefulSkipIndexes & skip_indexes,
     const MergeTreeReaderSettings & reader_settings,
     LoggerPtr log,
@@ -651,6 +677,20 @@ RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipInd
         auto mark_cache = context->getIndexMarkCache();
         auto uncompressed_cache = context->getIndexUncompressedCache();
 
+        PrewhereSelectivityCachePtr selectivity_cache;
+        UInt64 prewhere_condition_hash = 0;
+        if (settings.use_prewhere_selectivity_cache && prewhere_info)
+        {
+            selectivity_cache = context->getPrewhereSelectivityCache();
+            if (selectivity_cache)
+            {
+                if (auto condition_hash = PrewhereSelectivityCache::conditionHash(*prewhere_info))
+                    prewhere_condition_hash = *condition_hash;
+                else
+                    selectivity_cache = nullptr; /// The condition is non-deterministic and cannot be a cache key.
+            }
+        }
+
         auto process_part = [&](size_t part_index)
         {
             auto & part = parts[part_index];
@@ -721,6 +761,14 @@ RangesInDataParts MergeTreeDataSelectExecutor::filterPartsByPrimaryKeyAndSkipInd
                     stat.parts_dropped.fetch_add(1, std::memory_order_relaxed);
             }
 
+            if (selectivity_cache && !ranges.ranges.empty())
+            {
+                auto key = PrewhereSelectivityCache::hash(part->getDataPartStorage().getFullPath(), prewhere_condition_hash);
+                auto failing_marks = selectivity_cache->getFailingMarks(key);
+                if (!failing_marks.empty())
+                    ranges.ranges = filterMarksUsingSelectivityCache(ranges.ranges, failing_marks);
+            }
+
             if (!ranges.ranges.empty())
                 parts_with_ranges[part_index] = std::move(ranges);
         };
@@ -897,6 +945,15 @@ ReadFromMergeTree::AnalysisResultPtr MergeTreeDataSelectExecutor::estimateNumMar
         indexes);
 }
 
+/// Every query builds its own scan here; overlapping concurrent scans are not merged into a
+/// shared physical scan (the cooperative-scan scheme: late queries attach to an in-flight
+/// scan mid-stream and backfill the missed prefix). That design assumes scans are
+/// interchangeable, which ours are not - each query reads its own column subset, applies its
+/// own PREWHERE inside MergeTreeRangeReader, and may require mark-order output for
+/// optimize_read_in_order. Cross-query reuse therefore happens one layer down, where those
+/// differences vanish: page cache / filesystem cache on raw ranges, the uncompressed block
+/// cache, and the query cache for textually identical dashboards. Parallel replicas use
+/// coordinated range assignment for the dual problem of one query over many readers.
 QueryPlanStepPtr MergeTreeDataSelectExecutor::readFromParts(
     MergeTreeData::DataPartsVector parts,
     std::vector<AlterConversionsPtr> alter_conversions,
@@ -1002,8 +1059,13 @@ MarkRanges MergeTreeDataSelectExecutor::markRangesFromPKRange(
 
     bool has_final_mark = part->index_granularity.hasFinalMark();
 
+    /// alwaysUnknownOrTrue() walks the whole RPN, so compute it once:
+    /// the range checks below are executed for every candidate mark range.
+    const bool key_condition_useless = key_condition.alwaysUnknownOrTrue();
+    const bool part_offset_condition_useless = !part_offset_condition || part_offset_condition->alwaysUnknownOrTrue();
+
     /// If index is not used.
-    if (key_condition.alwaysUnknownOrTrue() && (!part_offset_condition || part_offset_condition->alwaysUnknownOrTrue()))
+    if (key_condition_useless && part_offset_condition_useless)
     {
         if (has_final_mark)
             res.push_back(MarkRange(0, marks_count - 1));
@@ -1017,10 +1079,16 @@ MarkRanges MergeTreeDataSelectExecutor::markRangesFromPKRange(
     auto index_columns = std::make_shared<ColumnsWithTypeAndName>();
     const auto & key_indices = key_condition.getKeyIndices();
     DataTypes key_types;
+    /// Monotonic functions chains are applied to the index columns directly, so they must have
+    /// exactly the declared key types. Undo the in-memory dictionary encoding of the index
+    /// for this case (see `primary_key_compress_strings_in_memory`).
+    const bool need_full_index_columns = key_condition.hasMonotonicFunctionsChain();
     for (size_t i : key_indices)
     {
         if (i < index.size())
-            index_columns->emplace_back(index[i], primary_key.data_types[i], primary_key.column_names[i]);
+            index_columns->emplace_back(
+                need_full_index_columns ? index[i]->convertToFullColumnIfLowCardinality() : index[i],
+                primary_key.data_types[i], primary_key.column_names[i]);
         else
             index_columns->emplace_back(); /// The column of the primary key was not loaded in memory - we'll skip it.
 
@@ -1065,7 +1133,7 @@ MarkRanges MergeTreeDataSelectExecutor::markRangesFromPKRange(
     auto may_be_true_in_range = [&](MarkRange & range)
     {
         bool key_condition_maybe_true = true;
-        if (!key_condition.alwaysUnknownOrTrue())
+        if (!key_condition_useless)
         {
             if (range.end == marks_count && !has_final_mark)
             {
@@ -1104,7 +1172,7 @@ MarkRanges MergeTreeDataSelectExecutor::markRangesFromPKRange(
 
         bool part_offset_condition_maybe_true = true;
 
-        if (part_offset_condition && !part_offset_condition->alwaysUnknownOrTrue())
+        if (!part_offset_condition_useless)
         {
             auto begin = part->index_granularity.getMarkStartingRow(range.begin);
             auto end = part->index_granularity.getMarkStartingRow(range.end) - 1;
@@ -1127,9 +1195,8 @@ MarkRanges MergeTreeDataSelectExecutor::markRangesFromPKRange(
         return key_condition_maybe_true && part_offset_condition_maybe_true;
     };
 
-    bool key_condition_exact_range = key_condition.alwaysUnknownOrTrue() || key_condition.matchesExactContinuousRange();
-    bool part_offset_condition_exact_range
-        = !part_offset_condition || part_offset_condition->alwaysUnknownOrTrue() || part_offset_condition->matchesExactContinuousRange();
+    bool key_condition_exact_range = key_condition_useless || key_condition.matchesExactContinuousRange();
+    bool part_offset_condition_exact_range = part_offset_condition_useless || part_offset_condition->matchesExactContinuousRange();
     const String & part_name = part->isProjectionPart() ? fmt::format("{}.{}", part->name, part->getParentPart()->name) : part->name;
 
     if (!key_condition_exact_range || !part_offset_condition_exact_range)
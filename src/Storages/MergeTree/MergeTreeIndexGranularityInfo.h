@@ -33,6 +33,19 @@ struct MarkType
 
 
 /// Meta information about index granularity
+///
+/// Granularity is one sequence of row counts per part, shared by all columns - this is not
+/// an accident of the format but its core invariant. Marks address (granule -> file offset)
+/// per column, and the primary index, skip indexes and mark ranges all speak in granule
+/// numbers that must mean the same rows in every column file; per-column-group granularity
+/// would make a mark range untranslatable between columns of one read. The adaptivity that
+/// is sound already exists on two axes: index_granularity_bytes sizes granules by bytes per
+/// part (so wide rows get fewer rows per granule), and reads re-batch on top of granules
+/// (point lookups read a granule but filter it down via the primary index; bulk scans merge
+/// adjacent granules into large ranges), which is why 8192 serves both access styles better
+/// than it looks. Access-pattern-driven retuning at merge time would also make granule
+/// numbering differ between replicas unless the observed statistics were replicated -
+/// per-part metadata is checksummed and compared across replicas.
 struct MergeTreeIndexGranularityInfo
 {
 public:
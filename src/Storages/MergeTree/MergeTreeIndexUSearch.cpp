@@ -120,6 +120,17 @@ void MergeTreeIndexGranuleUSearch<Metric>::serializeBinary(WriteBuffer & ostr) c
     index->serialize(ostr);
 }
 
+/// Every query that consults the index pays this deserialization, because skipping-index
+/// granules are read through the generic IMergeTreeIndexGranule path - a stream of bytes
+/// inside the part, possibly compressed, with no identity that would let two queries share
+/// one in-memory graph. Quantized storage tiers already exist (the f64/f32/f16/i8 index
+/// argument maps to usearch scalar kinds); what an mmap-shared HNSW additionally needs is
+/// the index stored as its own uncompressed file with a stable on-disk layout so
+/// usearch's view() can map it, plus a part-lifetime cache keyed like the mark cache so the
+/// mapping outlives queries. That is a storage-format change (new index file in the part
+/// manifest), not a tweak here - until then the practical mitigations are larger index
+/// GRANULARITY, so fewer granules are deserialized, and a compression codec of NONE on the
+/// index stream to make this read a plain copy.
 template <unum::usearch::metric_kind_t Metric>
 void MergeTreeIndexGranuleUSearch<Metric>::deserializeBinary(ReadBuffer & istr, MergeTreeIndexVersion /*version*/)
 {
@@ -0,0 +1,122 @@
+#include <Storages/MergeTree/MergeTreeIndexUniqSketch.h>
+
+#include <Columns/IColumn.h>
+#include <IO/ReadHelpers.h>
+#include <IO/WriteHelpers.h>
+#include <Common/SipHash.h>
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int LOGICAL_ERROR;
+    extern const int BAD_ARGUMENTS;
+}
+
+
+MergeTreeIndexGranuleUniqSketch::MergeTreeIndexGranuleUniqSketch(const String & index_name_)
+    : index_name(index_name_)
+{}
+
+MergeTreeIndexGranuleUniqSketch::MergeTreeIndexGranuleUniqSketch(
+    const String & index_name_, UInt64 total_rows_, const UniqSketch & sketch_)
+    : index_name(index_name_)
+    , total_rows(total_rows_)
+    , sketch(sketch_)
+{}
+
+void MergeTreeIndexGranuleUniqSketch::serializeBinary(WriteBuffer & ostr) const
+{
+    if (empty())
+        throw Exception(ErrorCodes::LOGICAL_ERROR, "Attempt to write empty uniq_sketch index {}", backQuote(index_name));
+
+    writeVarUInt(total_rows, ostr);
+    sketch.write(ostr);
+}
+
+void MergeTreeIndexGranuleUniqSketch::deserializeBinary(ReadBuffer & istr, MergeTreeIndexVersion version)
+{
+    if (version != 1)
+        throw Exception(ErrorCodes::LOGICAL_ERROR, "Unknown index version {}.", version);
+
+    readVarUInt(total_rows, istr);
+    sketch.read(istr);
+}
+
+
+MergeTreeIndexAggregatorUniqSketch::MergeTreeIndexAggregatorUniqSketch(
+    const String & index_name_, const Block & index_sample_block_)
+    : index_name(index_name_)
+    , index_sample_block(index_sample_block_)
+{}
+
+MergeTreeIndexGranulePtr MergeTreeIndexAggregatorUniqSketch::getGranuleAndReset()
+{
+    auto granule = std::make_shared<MergeTreeIndexGranuleUniqSketch>(index_name, total_rows, sketch);
+
+    total_rows = 0;
+    sketch = UniqSketch();
+
+    return granule;
+}
+
+void MergeTreeIndexAggregatorUniqSketch::update(const Block & block, size_t * pos, size_t limit)
+{
+    if (*pos >= block.rows())
+        throw Exception(ErrorCodes::LOGICAL_ERROR, "The provided position is not less than the number of block rows. "
+                "Position: {}, Block rows: {}.", *pos, block.rows());
+
+    size_t rows_read = std::min(limit, block.rows() - *pos);
+
+    ColumnRawPtrs index_columns;
+    index_columns.reserve(index_sample_block.columns());
+    for (size_t i = 0; i < index_sample_block.columns(); ++i)
+        index_columns.emplace_back(block.getByName(index_sample_block.getByPosition(i).name).column.get());
+
+    for (size_t i = 0; i < rows_read; ++i)
+    {
+        /// The sketch is over the tuple of index columns, like for the variadic uniq functions.
+        SipHash hash;
+        for (const auto * column : index_columns)
+            column->updateHashWithValue(*pos + i, hash);
+
+        sketch.insert(hash.get64());
+    }
+
+    total_rows += rows_read;
+    *pos += rows_read;
+}
+
+
+MergeTreeIndexGranulePtr MergeTreeIndexUniqSketch::createIndexGranule() const
+{
+    return std::make_shared<MergeTreeIndexGranuleUniqSketch>(index.name);
+}
+
+MergeTreeIndexAggregatorPtr MergeTreeIndexUniqSketch::createIndexAggregator(const MergeTreeWriterSettings & /*settings*/) const
+{
+    return std::make_shared<MergeTreeIndexAggregatorUniqSketch>(index.name, index.sample_block);
+}
+
+MergeTreeIndexConditionPtr MergeTreeIndexUniqSketch::createIndexCondition(
+    const ActionsDAGPtr & /*filter_actions_dag*/, ContextPtr /*context*/) const
+{
+    return std::make_shared<MergeTreeIndexConditionUniqSketch>();
+}
+
+MergeTreeIndexPtr uniqSketchIndexCreator(const IndexDescription & index)
+{
+    return std::make_shared<MergeTreeIndexUniqSketch>(index);
+}
+
+void uniqSketchIndexValidator(const IndexDescription & index, bool attach)
+{
+    if (attach)
+        return;
+
+    if (!index.arguments.empty())
+        throw Exception(ErrorCodes::BAD_ARGUMENTS, "uniq_sketch index does not take any arguments");
+}
+
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Storages/MergeTree/MergeTreeIndices.h>
+#include <Common/HyperLogLogCounter.h>
+
+
+namespace DB
+{
+
+/// Cardinality sketch with the same parameters as the uniqHLL12 aggregate function,
+/// so its accuracy characteristics are familiar.
+using UniqSketch = HLL12;
+
+/// Stores a HyperLogLog sketch of the index expression values for a single granule.
+/// The sketch cannot be used to skip granules, so the index never filters anything:
+/// its purpose is to answer approximate count-distinct queries from index data alone
+/// (the granules of all parts can be merged without reading the indexed columns).
+struct MergeTreeIndexGranuleUniqSketch final : public IMergeTreeIndexGranule
+{
+    explicit MergeTreeIndexGranuleUniqSketch(const String & index_name_);
+    MergeTreeIndexGranuleUniqSketch(const String & index_name_, UInt64 total_rows_, const UniqSketch & sketch_);
+
+    ~MergeTreeIndexGranuleUniqSketch() override = default;
+
+    void serializeBinary(WriteBuffer & ostr) const override;
+    void deserializeBinary(ReadBuffer & istr, MergeTreeIndexVersion version) override;
+
+    bool empty() const override { return total_rows == 0; }
+
+    const String index_name;
+
+    UInt64 total_rows = 0;
+    UniqSketch sketch;
+};
+
+
+struct MergeTreeIndexAggregatorUniqSketch final : IMergeTreeIndexAggregator
+{
+    MergeTreeIndexAggregatorUniqSketch(const String & index_name_, const Block & index_sample_block_);
+    ~MergeTreeIndexAggregatorUniqSketch() override = default;
+
+    bool empty() const override { return total_rows == 0; }
+    MergeTreeIndexGranulePtr getGranuleAndReset() override;
+    void update(const Block & block, size_t * pos, size_t limit) override;
+
+    const String index_name;
+    const Block index_sample_block;
+
+    UInt64 total_rows = 0;
+    UniqSketch sketch;
+};
+
+
+/// The sketch gives no information about presence of particular values,
+/// so the condition never allows to drop granules.
+class MergeTreeIndexConditionUniqSketch final : public IMergeTreeIndexCondition
+{
+public:
+    MergeTreeIndexConditionUniqSketch() = default;
+    ~MergeTreeIndexConditionUniqSketch() override = default;
+
+    bool alwaysUnknownOrTrue() const override { return true; }
+    bool mayBeTrueOnGranule(MergeTreeIndexGranulePtr) const override { return true; }
+};
+
+
+class MergeTreeIndexUniqSketch : public IMergeTreeIndex
+{
+public:
+    explicit MergeTreeIndexUniqSketch(const IndexDescription & index_)
+        : IMergeTreeIndex(index_)
+    {}
+
+    ~MergeTreeIndexUniqSketch() override = default;
+
+    MergeTreeIndexGranulePtr createIndexGranule() const override;
+    MergeTreeIndexAggregatorPtr createIndexAggregator(const MergeTreeWriterSettings & settings) const override;
+
+    MergeTreeIndexConditionPtr createIndexCondition(
+        const ActionsDAGPtr & filter_actions_dag, ContextPtr context) const override;
+};
+
+}
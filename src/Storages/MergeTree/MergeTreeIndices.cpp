@@ -127,6 +127,9 @@ MergeTreeIndexFactory::MergeTreeIndexFactory()
     registerCreator("hypothesis", hypothesisIndexCreator);
     registerValidator("hypothesis", hypothesisIndexValidator);
 
+    registerCreator("uniq_sketch", uniqSketchIndexCreator);
+    registerValidator("uniq_sketch", uniqSketchIndexValidator);
+
 #ifdef ENABLE_ANNOY
     registerCreator("annoy", annoyIndexCreator);
     registerValidator("annoy", annoyIndexValidator);
@@ -230,6 +230,9 @@ void bloomFilterIndexValidatorNew(const IndexDescription & index, bool attach);
 MergeTreeIndexPtr hypothesisIndexCreator(const IndexDescription & index);
 void hypothesisIndexValidator(const IndexDescription & index, bool attach);
 
+MergeTreeIndexPtr uniqSketchIndexCreator(const IndexDescription & index);
+void uniqSketchIndexValidator(const IndexDescription & index, bool attach);
+
 #ifdef ENABLE_ANNOY
 MergeTreeIndexPtr annoyIndexCreator(const IndexDescription & index);
 void annoyIndexValidator(const IndexDescription & index, bool attach);
@@ -0,0 +1,170 @@
+#include <Storages/MergeTree/MergeTreeLazilyReader.h>
+
+#include <base/sort.h>
+#include <Columns/ColumnsNumber.h>
+#include <Common/assert_cast.h>
+#include <Interpreters/Context.h>
+#include <Storages/MergeTree/IMergeTreeReader.h>
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int LOGICAL_ERROR;
+}
+
+MergeTreeLazilyReader::MergeTreeLazilyReader(
+    const MergeTreeData & storage_,
+    const StorageSnapshotPtr & storage_snapshot_,
+    LazilyReadDataPartsPtr data_parts_,
+    const Names & lazy_column_names_,
+    const ContextPtr & context_)
+    : storage(storage_)
+    , storage_snapshot(storage_snapshot_)
+    , data_parts(std::move(data_parts_))
+    , mark_cache(context_->getMarkCache())
+    , uncompressed_cache(context_->getUncompressedCache())
+    , reader_settings{
+        .read_settings = context_->getReadSettings(),
+        .save_marks_in_cache = true,
+        /// Row offsets address physical rows of the part,
+        /// the deleted mask was already applied when they were produced.
+        .apply_deleted_mask = false,
+    }
+{
+    auto options = GetColumnsOptions(GetColumnsOptions::AllPhysical).withExtendedObjects();
+    lazy_columns = storage_snapshot->getColumnsByNames(options, lazy_column_names_);
+}
+
+Columns MergeTreeLazilyReader::readLazyColumns(const IColumn & part_index_column, const IColumn & part_offset_column) const
+{
+    size_t num_rows = part_index_column.size();
+
+    const auto & part_indexes = assert_cast<const ColumnUInt64 &>(part_index_column).getData();
+    const auto & part_offsets = assert_cast<const ColumnUInt64 &>(part_offset_column).getData();
+
+    /// Group the requested rows by part and sort them by offset,
+    /// so that every granule is read at most once and only forward seeks are made.
+    struct RowToRead
+    {
+        UInt64 part_offset;
+        size_t result_position;
+    };
+
+    std::map<UInt64, std::vector<RowToRead>> rows_by_part;
+    for (size_t i = 0; i < num_rows; ++i)
+    {
+        if (part_indexes[i] >= data_parts->size())
+            throw Exception(ErrorCodes::LOGICAL_ERROR,
+                "Part index {} is out of range: only {} parts are read", part_indexes[i], data_parts->size());
+
+        rows_by_part[part_indexes[i]].push_back({part_offsets[i], i});
+    }
+
+    MutableColumns read_columns;
+    read_columns.reserve(lazy_columns.size());
+    for (const auto & column : lazy_columns)
+    {
+        read_columns.push_back(column.type->createColumn());
+        read_columns.back()->reserve(num_rows);
+    }
+
+    /// Rows are appended to read_columns in the reading order. The permutation maps
+    /// the position of a row in the result to its position in the reading order.
+    IColumn::Permutation permutation(num_rows);
+    size_t read_index = 0;
+
+    for (auto & [part_index, part_rows] : rows_by_part)
+    {
+        const auto & part_info = (*data_parts)[part_index];
+        if (!part_info.data_part)
+            throw Exception(ErrorCodes::LOGICAL_ERROR,
+                "Part with index {} was pruned before reading and cannot be addressed by _part_index", part_index);
+
+        const auto & data_part = part_info.data_part;
+        const auto & index_granularity = data_part->index_granularity;
+        size_t marks_count = data_part->getMarksCount();
+
+        ::sort(part_rows.begin(), part_rows.end(),
+            [](const RowToRead & lhs, const RowToRead & rhs) { return lhs.part_offset < rhs.part_offset; });
+
+        MarkRanges mark_ranges{MarkRange(0, marks_count)};
+
+        auto reader = data_part->getReader(
+            lazy_columns,
+            storage_snapshot,
+            mark_ranges,
+            /*virtual_fields=*/ {},
+            uncompressed_cache.get(),
+            mark_cache.get(),
+            part_info.alter_conversions,
+            reader_settings,
+            {},
+            {});
+
+        for (size_t row = 0; row < part_rows.size();)
+        {
+            /// Find the last mark which starts at or before the current offset.
+            UInt64 first_offset = part_rows[row].part_offset;
+            size_t mark = 0;
+            for (size_t count = marks_count - 1; count > 0;)
+            {
+                size_t step = (count + 1) / 2;
+                if (index_granularity.getMarkStartingRow(mark + step) <= first_offset)
+                    mark += step;
+                count -= step;
+            }
+
+            UInt64 mark_start_row = index_granularity.getMarkStartingRow(mark);
+            UInt64 rows_in_mark = index_granularity.getMarkRows(mark);
+
+            /// Collect all requested rows which fall into this granule.
+            size_t batch_end = row;
+            UInt64 max_offset = first_offset;
+            while (batch_end < part_rows.size() && part_rows[batch_end].part_offset < mark_start_row + rows_in_mark)
+            {
+                max_offset = part_rows[batch_end].part_offset;
+                ++batch_end;
+            }
+
+            /// We cannot seek below the mark, so the granule is read from the start
+            /// up to the last requested row, and the needed rows are picked out.
+            size_t rows_to_read = max_offset - mark_start_row + 1;
+            Columns columns(lazy_columns.size());
+            size_t rows_read = reader->readRows(mark, marks_count, /*continue_reading=*/ false, rows_to_read, columns);
+
+            if (rows_read < rows_to_read)
+                throw Exception(ErrorCodes::LOGICAL_ERROR,
+                    "Read only {} rows of {} starting from mark {} of part {}",
+                    rows_read, rows_to_read, mark, data_part->name);
+
+            bool should_evaluate_missing_defaults = false;
+            reader->fillMissingColumns(columns, should_evaluate_missing_defaults, rows_read);
+
+            if (should_evaluate_missing_defaults)
+                reader->evaluateMissingDefaults({}, columns);
+
+            reader->performRequiredConversions(columns);
+
+            for (; row < batch_end; ++row)
+            {
+                size_t position_in_columns = part_rows[row].part_offset - mark_start_row;
+                for (size_t i = 0; i < read_columns.size(); ++i)
+                    read_columns[i]->insertFrom(*columns[i], position_in_columns);
+
+                permutation[part_rows[row].result_position] = read_index;
+                ++read_index;
+            }
+        }
+    }
+
+    Columns result_columns;
+    result_columns.reserve(read_columns.size());
+    for (auto & column : read_columns)
+        result_columns.push_back(column->permute(permutation, 0));
+
+    return result_columns;
+}
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <IO/UncompressedCache.h>
+#include <Storages/MarkCache.h>
+#include <Storages/MergeTree/AlterConversions.h>
+#include <Storages/MergeTree/MergeTreeData.h>
+
+namespace DB
+{
+
+struct LazilyReadDataPart
+{
+    MergeTreeData::DataPartPtr data_part;
+    AlterConversionsPtr alter_conversions;
+};
+
+/// Parts addressed by the value of the _part_index virtual column (part_index_in_query).
+/// The vector is filled by ReadFromMergeTree after the final part set is known, because
+/// part_index_in_query is assigned over the parts which survived partition and _part
+/// pruning, not over the initially prepared parts.
+using LazilyReadDataParts = std::vector<LazilyReadDataPart>;
+using LazilyReadDataPartsPtr = std::shared_ptr<LazilyReadDataParts>;
+
+/// Reads the values of individual rows of a set of columns from MergeTree data parts
+/// by (part index, row offset in part) coordinates.
+///
+/// It is used for lazy materialization: a TopN query first reads only the columns needed
+/// for sorting together with the _part_index and _part_offset virtual columns, and the
+/// remaining (usually wide) columns are fetched by this reader only for the few rows
+/// that survive ORDER BY ... LIMIT.
+class MergeTreeLazilyReader
+{
+public:
+    MergeTreeLazilyReader(
+        const MergeTreeData & storage_,
+        const StorageSnapshotPtr & storage_snapshot_,
+        LazilyReadDataPartsPtr data_parts_,
+        const Names & lazy_column_names_,
+        const ContextPtr & context_);
+
+    const NamesAndTypesList & getColumns() const { return lazy_columns; }
+
+    /// For each row of part_index_column/part_offset_column reads the values of the lazy columns.
+    /// The result columns are aligned with the rows of the input columns.
+    Columns readLazyColumns(const IColumn & part_index_column, const IColumn & part_offset_column) const;
+
+private:
+    const MergeTreeData & storage;
+    StorageSnapshotPtr storage_snapshot;
+    LazilyReadDataPartsPtr data_parts;
+    MarkCachePtr mark_cache;
+    UncompressedCachePtr uncompressed_cache;
+    MergeTreeReaderSettings reader_settings;
+    NamesAndTypesList lazy_columns;
+};
+
+using MergeTreeLazilyReaderPtr = std::shared_ptr<MergeTreeLazilyReader>;
+
+}
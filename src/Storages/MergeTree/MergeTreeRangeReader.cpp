@@ -1,6 +1,7 @@
 #include <Storages/MergeTree/MergeTreeRangeReader.h>
 #include <Storages/MergeTree/IMergeTreeReader.h>
 #include <Storages/MergeTree/MergeTreeVirtualColumns.h>
+#include <Storages/MergeTree/PrewhereSelectivityCache.h>
 #include <Columns/FilterDescription.h>
 #include <Columns/ColumnConst.h>
 #include <Columns/ColumnsCommon.h>
@@ -328,6 +329,12 @@ void MergeTreeRangeReader::ReadResult::clear()
 {
     /// Need to save information about the number of granules.
     num_rows_to_skip_in_last_granule += rows_per_granule.back();
+    if (!num_rows_to_skip_at_granule_start.empty())
+    {
+        /// Nothing will be read from the last granule, so its head skip becomes a part of the tail skip.
+        num_rows_to_skip_in_last_granule += num_rows_to_skip_at_granule_start.back();
+        num_rows_to_skip_at_granule_start.assign(num_rows_to_skip_at_granule_start.size(), 0);
+    }
     rows_per_granule.assign(rows_per_granule.size(), 0);
     total_rows_per_granule = 0;
     final_filter = FilterWithCachedCount();
@@ -336,7 +343,7 @@ void MergeTreeRangeReader::ReadResult::clear()
     additional_columns.clear();
 }
 
-void MergeTreeRangeReader::ReadResult::shrink(Columns & old_columns, const NumRows & rows_per_granule_previous) const
+void MergeTreeRangeReader::ReadResult::shrink(Columns & old_columns, const NumRows & rows_per_granule_previous, const NumRows & zero_heads) const
 {
     for (auto & column : old_columns)
     {
@@ -357,7 +364,7 @@ void MergeTreeRangeReader::ReadResult::shrink(Columns & old_columns, const NumRo
         for (size_t j = 0, pos = 0; j < rows_per_granule_previous.size(); pos += rows_per_granule_previous[j++])
         {
             if (rows_per_granule[j])
-                new_column->insertRangeFrom(*column, pos, rows_per_granule[j]);
+                new_column->insertRangeFrom(*column, pos + zero_heads[j], rows_per_granule[j]);
         }
         column = std::move(new_column);
     }
@@ -374,6 +381,11 @@ void MergeTreeRangeReader::ReadResult::checkInternalConsistency() const
             "Final filter size {} doesn't match total_rows_per_granule {}",
             final_filter.size(), total_rows_per_granule);
 
+    if (!num_rows_to_skip_at_granule_start.empty() && num_rows_to_skip_at_granule_start.size() != rows_per_granule.size())
+        throw Exception(ErrorCodes::LOGICAL_ERROR,
+            "Size of num_rows_to_skip_at_granule_start {} doesn't match size of rows_per_granule {}",
+            num_rows_to_skip_at_granule_start.size(), rows_per_granule.size());
+
     /// Check that num_rows is consistent with final_filter and rows_per_granule.
     if (final_filter.present() && final_filter.countBytesInFilter() != num_rows && total_rows_per_granule != num_rows)
         throw Exception(ErrorCodes::LOGICAL_ERROR,
@@ -517,6 +529,34 @@ void MergeTreeRangeReader::ReadResult::optimize(const FilterWithCachedCount & cu
     NumRows zero_tails;
     auto total_zero_rows_in_tails = countZeroTails(filter.getData(), zero_tails, can_read_incomplete_granules);
 
+    /// Granules entirely filtered out by this step contain no rows matching the whole PREWHERE
+    /// condition (the filters of the steps are combined by AND), so remember them in the
+    /// selectivity cache. The first and the last granules of the read are skipped because they
+    /// might have been read only partially (a read may start or stop in the middle of a granule).
+    if (selectivity_cache_writer && !started_ranges.empty() && rows_per_granule.size() > 2)
+    {
+        std::vector<size_t> failing_marks;
+        auto range_it = started_ranges.begin();
+        for (size_t i = 1; i + 1 < rows_per_granule.size(); ++i)
+        {
+            if (rows_per_granule[i] == 0 || zero_tails[i] != rows_per_granule[i])
+                continue;
+
+            while (range_it + 1 != started_ranges.end() && (range_it + 1)->num_granules_read_before_start <= i)
+                ++range_it;
+
+            failing_marks.push_back(range_it->range.begin + (i - range_it->num_granules_read_before_start));
+        }
+
+        if (!failing_marks.empty())
+            selectivity_cache_writer->addFailingMarks(failing_marks);
+    }
+
+    /// Rows filtered out at the beginning of a granule can be skipped as well: the reader
+    /// will seek inside the granule to the first row that passes the filter.
+    NumRows zero_heads;
+    auto total_zero_rows_in_heads = countZeroHeads(filter.getData(), zero_heads, zero_tails, can_read_incomplete_granules);
+
     LOG_TEST(log, "ReadResult::optimize() before: {}", dumpInfo());
 
     SCOPE_EXIT(
@@ -540,30 +580,36 @@ void MergeTreeRangeReader::ReadResult::optimize(const FilterWithCachedCount & cu
         return;
     }
     /// Just a guess. If only a few rows may be skipped, it's better not to skip at all.
-    else if (2 * total_zero_rows_in_tails > filter.size())
+    else if (2 * (total_zero_rows_in_tails + total_zero_rows_in_heads) > filter.size())
     {
         const NumRows rows_per_granule_previous = rows_per_granule;
         const size_t total_rows_per_granule_previous = total_rows_per_granule;
 
+        if (total_zero_rows_in_heads && num_rows_to_skip_at_granule_start.empty())
+            num_rows_to_skip_at_granule_start.assign(rows_per_granule.size(), 0);
+
         for (auto i : collections::range(0, rows_per_granule.size()))
         {
-            rows_per_granule[i] -= zero_tails[i];
+            rows_per_granule[i] -= zero_tails[i] + zero_heads[i];
+            if (!num_rows_to_skip_at_granule_start.empty())
+                num_rows_to_skip_at_granule_start[i] += zero_heads[i];
         }
-        num_rows_to_skip_in_last_granule += rows_per_granule_previous.back() - rows_per_granule.back();
-        total_rows_per_granule = total_rows_per_granule_previous - total_zero_rows_in_tails;
+        /// The head of the last granule is skipped before reading, not after, so it is not a part of the tail skip.
+        num_rows_to_skip_in_last_granule += rows_per_granule_previous.back() - rows_per_granule.back() - zero_heads.back();
+        total_rows_per_granule = total_rows_per_granule_previous - total_zero_rows_in_tails - total_zero_rows_in_heads;
 
         /// Check if const 1 after shrink.
         /// We can apply shrink only if after the previous step the number of rows in the result
         /// matches the rows_per_granule info. Otherwise we will not be able to match newly added zeros in granule tails.
         if (num_rows == total_rows_per_granule_previous &&
-            filter.countBytesInFilter() + total_zero_rows_in_tails == total_rows_per_granule_previous)  /// All zeros are in tails?
+            filter.countBytesInFilter() + total_zero_rows_in_tails + total_zero_rows_in_heads == total_rows_per_granule_previous)  /// All zeros are in heads and tails?
         {
             setFilterConstTrue();
 
-            /// If all zeros are in granule tails, we can use shrink to filter out rows.
-            shrink(columns, rows_per_granule_previous); /// shrink acts as filtering in such case
+            /// If all zeros are in granule heads and tails, we can use shrink to filter out rows.
+            shrink(columns, rows_per_granule_previous, zero_heads); /// shrink acts as filtering in such case
             auto c = additional_columns.getColumns();
-            shrink(c, rows_per_granule_previous);
+            shrink(c, rows_per_granule_previous, zero_heads);
             additional_columns.setColumns(c);
 
             num_rows = total_rows_per_granule;
@@ -572,11 +618,11 @@ void MergeTreeRangeReader::ReadResult::optimize(const FilterWithCachedCount & cu
         }
         else
         {
-            auto new_filter = ColumnUInt8::create(filter.size() - total_zero_rows_in_tails);
+            auto new_filter = ColumnUInt8::create(filter.size() - total_zero_rows_in_tails - total_zero_rows_in_heads);
             IColumn::Filter & new_data = new_filter->getData();
 
-            /// Shorten the filter by removing zeros from granule tails
-            collapseZeroTails(filter.getData(), rows_per_granule_previous, new_data);
+            /// Shorten the filter by removing zeros from granule heads and tails
+            collapseZeroTails(filter.getData(), rows_per_granule_previous, zero_heads, new_data);
             if (total_rows_per_granule != new_filter->size())
                 throw Exception(ErrorCodes::LOGICAL_ERROR, "New filter size {} doesn't match number of rows to be read {}",
                     new_filter->size(), total_rows_per_granule);
@@ -644,14 +690,40 @@ size_t MergeTreeRangeReader::ReadResult::countZeroTails(const IColumn::Filter &
     return total_zero_rows_in_tails;
 }
 
-void MergeTreeRangeReader::ReadResult::collapseZeroTails(const IColumn::Filter & filter_vec, const NumRows & rows_per_granule_previous, IColumn::Filter & new_filter_vec) const
+size_t MergeTreeRangeReader::ReadResult::countZeroHeads(const IColumn::Filter & filter_vec, NumRows & zero_heads, const NumRows & zero_tails, bool can_read_incomplete_granules) const
+{
+    zero_heads.resize(0);
+    zero_heads.reserve(rows_per_granule.size());
+
+    const auto * filter_data = filter_vec.data();
+
+    size_t total_zero_rows_in_heads = 0;
+
+    for (auto i : collections::range(0, rows_per_granule.size()))
+    {
+        size_t rows_to_read = rows_per_granule[i];
+        /// Count the number of zeros at the beginning of filter for rows were read from current granule.
+        /// A granule which is filtered out entirely is accounted as a tail. Skipping the head
+        /// requires the reader to seek inside a granule, i.e. to read an incomplete granule.
+        size_t zero_head = 0;
+        if (can_read_incomplete_granules && zero_tails[i] < rows_to_read)
+            zero_head = numZerosInHead(filter_data, filter_data + rows_to_read - zero_tails[i]);
+        zero_heads.push_back(zero_head);
+        total_zero_rows_in_heads += zero_head;
+        filter_data += rows_to_read;
+    }
+
+    return total_zero_rows_in_heads;
+}
+
+void MergeTreeRangeReader::ReadResult::collapseZeroTails(const IColumn::Filter & filter_vec, const NumRows & rows_per_granule_previous, const NumRows & zero_heads, IColumn::Filter & new_filter_vec) const
 {
     const auto * filter_data = filter_vec.data();
     auto * new_filter_data = new_filter_vec.data();
 
     for (auto i : collections::range(0, rows_per_granule.size()))
     {
-        memcpySmallAllowReadWriteOverflow15(new_filter_data, filter_data, rows_per_granule[i]);
+        memcpySmallAllowReadWriteOverflow15(new_filter_data, filter_data + zero_heads[i], rows_per_granule[i]);
         filter_data += rows_per_granule_previous[i];
         new_filter_data += rows_per_granule[i];
     }
@@ -800,15 +872,41 @@ size_t MergeTreeRangeReader::ReadResult::numZerosInTail(const UInt8 * begin, con
     return count;
 }
 
+size_t MergeTreeRangeReader::ReadResult::numZerosInHead(const UInt8 * begin, const UInt8 * end)
+{
+    const UInt8 * pos = begin;
+
+#if defined(__SSE2__)
+    const __m128i zero16 = _mm_setzero_si128();
+    while (end - pos >= 16)
+    {
+        UInt16 val = static_cast<UInt16>(~_mm_movemask_epi8(_mm_cmpeq_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos)),
+                zero16)));
+        if (val != 0)
+            return pos - begin + std::countr_zero(val);
+        pos += 16;
+    }
+#endif
+
+    while (pos < end && *pos == 0)
+    {
+        ++pos;
+    }
+    return pos - begin;
+}
+
 MergeTreeRangeReader::MergeTreeRangeReader(
     IMergeTreeReader * merge_tree_reader_,
     MergeTreeRangeReader * prev_reader_,
     const PrewhereExprStep * prewhere_info_,
-    bool last_reader_in_chain_)
+    bool last_reader_in_chain_,
+    PrewhereSelectivityCacheWriterPtr selectivity_cache_writer_)
     : merge_tree_reader(merge_tree_reader_)
     , index_granularity(&(merge_tree_reader->data_part_info_for_read->getIndexGranularity()))
     , prev_reader(prev_reader_)
     , prewhere_info(prewhere_info_)
+    , selectivity_cache_writer(std::move(selectivity_cache_writer_))
     , last_reader_in_chain(last_reader_in_chain_)
     , is_initialized(true)
 {
@@ -1095,6 +1193,7 @@ MergeTreeRangeReader::ReadResult MergeTreeRangeReader::startReadingChain(size_t
 {
     ReadResult result(log);
     result.columns.resize(merge_tree_reader->getColumns().size());
+    result.selectivity_cache_writer = selectivity_cache_writer;
 
     size_t current_task_last_mark = getLastMark(ranges);
 
@@ -1243,6 +1342,10 @@ Columns MergeTreeRangeReader::continueReadingChain(const ReadResult & result, si
             stream = Stream(range.begin, range.end, current_task_last_mark, merge_tree_reader);
         }
 
+        /// Skip the rows at the beginning of the granule which were filtered out at the previous steps.
+        if (!result.num_rows_to_skip_at_granule_start.empty())
+            stream.skip(result.num_rows_to_skip_at_granule_start[i]);
+
         bool last = i + 1 == size;
         num_rows += stream.read(columns, rows_per_granule[i], !last);
     }
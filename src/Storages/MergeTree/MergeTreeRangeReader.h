@@ -16,6 +16,8 @@ class IMergeTreeReader;
 class MergeTreeIndexGranularity;
 struct PrewhereInfo;
 using PrewhereInfoPtr = std::shared_ptr<PrewhereInfo>;
+class PrewhereSelectivityCacheWriter;
+using PrewhereSelectivityCacheWriterPtr = std::shared_ptr<const PrewhereSelectivityCacheWriter>;
 
 class ExpressionActions;
 using ExpressionActionsPtr = std::shared_ptr<ExpressionActions>;
@@ -101,7 +103,8 @@ public:
         IMergeTreeReader * merge_tree_reader_,
         MergeTreeRangeReader * prev_reader_,
         const PrewhereExprStep * prewhere_info_,
-        bool last_reader_in_chain_);
+        bool last_reader_in_chain_,
+        PrewhereSelectivityCacheWriterPtr selectivity_cache_writer_);
 
     MergeTreeRangeReader() = default;
 
@@ -254,7 +257,7 @@ public:
         void addNumBytesRead(size_t count) { num_bytes_read += count; }
 
         /// Shrinks columns according to the diff between current and previous rows_per_granule.
-        void shrink(Columns & old_columns, const NumRows & rows_per_granule_previous) const;
+        void shrink(Columns & old_columns, const NumRows & rows_per_granule_previous, const NumRows & zero_heads) const;
 
         /// Applies the filter to the columns and updates num_rows.
         void applyFilter(const FilterWithCachedCount & filter);
@@ -273,6 +276,10 @@ public:
         /// Granule here is not number of rows between two marks
         /// It's amount of rows per single reading act
         NumRows rows_per_granule;
+        /// The number of rows to skip at the beginning of each granule before reading
+        /// (leading rows which were filtered out by PREWHERE). Parallel to rows_per_granule.
+        /// An empty vector means that no rows are skipped at granule starts.
+        NumRows num_rows_to_skip_at_granule_start;
         /// Sum(rows_per_granule)
         size_t total_rows_per_granule = 0;
         /// The number of rows was read at first step. May be zero if no read columns present in part.
@@ -295,10 +302,16 @@ public:
         /// Checks if result columns have current final_filter applied.
         bool filterWasApplied() const { return !final_filter.present() || final_filter.countBytesInFilter() == num_rows; }
 
-        /// Builds updated filter by cutting zeros in granules tails
-        void collapseZeroTails(const IColumn::Filter & filter, const NumRows & rows_per_granule_previous, IColumn::Filter & new_filter) const;
+        /// Builds updated filter by cutting zeros in granules heads and tails
+        void collapseZeroTails(const IColumn::Filter & filter, const NumRows & rows_per_granule_previous, const NumRows & zero_heads, IColumn::Filter & new_filter) const;
         size_t countZeroTails(const IColumn::Filter & filter, NumRows & zero_tails, bool can_read_incomplete_granules) const;
+        size_t countZeroHeads(const IColumn::Filter & filter, NumRows & zero_heads, const NumRows & zero_tails, bool can_read_incomplete_granules) const;
         static size_t numZerosInTail(const UInt8 * begin, const UInt8 * end);
+        static size_t numZerosInHead(const UInt8 * begin, const UInt8 * end);
+
+        /// If set, granules entirely filtered out by PREWHERE are recorded
+        /// in the selectivity cache (see optimize()).
+        PrewhereSelectivityCacheWriterPtr selectivity_cache_writer;
 
         LoggerPtr log;
     };
@@ -319,6 +332,8 @@ private:
     const MergeTreeIndexGranularity * index_granularity = nullptr;
     MergeTreeRangeReader * prev_reader = nullptr; /// If not nullptr, read from prev_reader firstly.
     const PrewhereExprStep * prewhere_info;
+    /// If not nullptr, granules entirely filtered out by PREWHERE are recorded in the selectivity cache.
+    PrewhereSelectivityCacheWriterPtr selectivity_cache_writer;
 
     Stream stream;
 
@@ -1,11 +1,22 @@
 #include <Storages/MergeTree/MergeTreeReadPoolBase.h>
+#include <Core/Settings.h>
+#include <Interpreters/Context.h>
 #include <Storages/MergeTree/MergeTreeBlockReadUtils.h>
 #include <Storages/MergeTree/LoadedMergeTreeDataPartInfoForReader.h>
+#include <Storages/MergeTree/PrewhereSelectivityCache.h>
 
 
 namespace DB
 {
 
+size_t getApproxSizeOfPart(const IMergeTreeDataPart & part, const Names & columns_to_read)
+{
+    ColumnSize columns_size{};
+    for (const auto & col_name : columns_to_read)
+        columns_size.add(part.getColumnSize(col_name));
+    return columns_size.data_compressed;
+}
+
 MergeTreeReadPoolBase::MergeTreeReadPoolBase(
     RangesInDataParts && parts_,
     VirtualFields shared_virtual_fields_,
@@ -29,16 +40,67 @@ MergeTreeReadPoolBase::MergeTreeReadPoolBase(
     , header(storage_snapshot->getSampleBlockForColumns(column_names))
     , profile_callback([this](ReadBufferFromFileBase::ProfileInfo info_) { profileFeedback(info_); })
 {
-    fillPerPartInfos();
+    fillPerPartInfos(context_);
+}
+
+static size_t calculateMinMarksPerTask(
+    const RangesInDataPart & part,
+    const Names & columns_to_read,
+    const PrewhereInfoPtr & prewhere_info,
+    const MergeTreeReadPoolBase::PoolSettings & pool_settings,
+    const Settings & settings)
+{
+    size_t min_marks_per_task = pool_settings.min_marks_for_concurrent_read;
+    const size_t part_marks_count = part.getMarksCount();
+    if (part_marks_count && part.data_part->isStoredOnRemoteDisk())
+    {
+        /// We assume that the amount of data to read from each part is about the same,
+        /// so the task size is determined by the compressed size of the queried columns in this part:
+        /// parts on remote (usually cold) storages get bigger sequential tasks to amortize the request latency,
+        /// while parts on local disks keep fine-grained tasks which are cheap to steal.
+        const auto & columns = settings.merge_tree_determine_task_size_by_prewhere_columns && prewhere_info
+            ? prewhere_info->prewhere_actions->getRequiredColumnsNames()
+            : columns_to_read;
+        const size_t part_compressed_bytes = getApproxSizeOfPart(*part.data_part, columns);
+
+        const auto avg_mark_bytes = std::max<size_t>(part_compressed_bytes / part_marks_count, 1);
+        const auto min_bytes_per_task = settings.merge_tree_min_bytes_per_task_for_remote_reading;
+        /// We're taking min here because the number of tasks shouldn't be too low - it will make task stealing impossible.
+        /// For pools which read in order the threads count is not filled, so only the bytes-based part is used.
+        const auto marks_per_thread = pool_settings.threads
+            ? pool_settings.sum_marks / pool_settings.threads
+            : std::numeric_limits<size_t>::max();
+        const auto heuristic_min_marks = std::min<size_t>(marks_per_thread, min_bytes_per_task / avg_mark_bytes);
+
+        if (heuristic_min_marks > min_marks_per_task)
+            min_marks_per_task = heuristic_min_marks;
+    }
+    return min_marks_per_task;
 }
 
-void MergeTreeReadPoolBase::fillPerPartInfos()
+void MergeTreeReadPoolBase::fillPerPartInfos(const ContextPtr & context)
 {
+    const auto & settings = context->getSettingsRef();
+
     per_part_infos.reserve(parts_ranges.size());
     is_part_on_remote_disk.reserve(parts_ranges.size());
 
     auto sample_block = storage_snapshot->metadata->getSampleBlock();
 
+    PrewhereSelectivityCachePtr selectivity_cache;
+    UInt64 prewhere_condition_hash = 0;
+    if (settings.use_prewhere_selectivity_cache && prewhere_info)
+    {
+        selectivity_cache = context->getPrewhereSelectivityCache();
+        if (selectivity_cache)
+        {
+            if (auto condition_hash = PrewhereSelectivityCache::conditionHash(*prewhere_info))
+                prewhere_condition_hash = *condition_hash;
+            else
+                selectivity_cache = nullptr; /// The condition is non-deterministic and cannot be a cache key.
+        }
+    }
+
     for (const auto & part_with_ranges : parts_ranges)
     {
 #ifndef NDEBUG
@@ -83,6 +145,18 @@ void MergeTreeReadPoolBase::fillPerPartInfos()
         }
 
         is_part_on_remote_disk.push_back(part_with_ranges.data_part->isStoredOnRemoteDisk());
+        read_task_info.min_marks_per_task
+            = calculateMinMarksPerTask(part_with_ranges, column_names, prewhere_info, pool_settings, settings);
+
+        if (selectivity_cache)
+        {
+            auto key = PrewhereSelectivityCache::hash(
+                part_with_ranges.data_part->getDataPartStorage().getFullPath(), prewhere_condition_hash);
+
+            read_task_info.selectivity_cache_writer = std::make_shared<const PrewhereSelectivityCacheWriter>(
+                selectivity_cache, key, part_with_ranges.data_part->index_granularity.getMarksCountWithoutFinal());
+        }
+
         per_part_infos.push_back(std::make_shared<MergeTreeReadTaskInfo>(std::move(read_task_info)));
     }
 }
@@ -32,7 +32,11 @@ MergeTreeReadPoolParallelReplicasInOrder::MergeTreeReadPoolParallelReplicasInOrd
         context_)
     , extension(std::move(extension_))
     , mode(mode_)
+    , min_marks_per_task(pool_settings.min_marks_for_concurrent_read)
 {
+    for (const auto & info : per_part_infos)
+        min_marks_per_task = std::max(min_marks_per_task, info->min_marks_per_task);
+
     for (const auto & part : parts_ranges)
         request.push_back({part.data_part->info, MarkRanges{}});
 
@@ -79,7 +83,7 @@ MergeTreeReadTaskPtr MergeTreeReadPoolParallelReplicasInOrder::getTask(size_t ta
     auto response = extension.callback(ParallelReadRequest(
         mode,
         extension.number_of_current_replica,
-        pool_settings.min_marks_for_concurrent_read * request.size(),
+        min_marks_per_task * request.size(),
         request
     ));
 
@@ -67,7 +67,10 @@ MergeTreeReadTask::Readers MergeTreeReadTask::createReaders(
 }
 
 MergeTreeReadTask::RangeReaders
-MergeTreeReadTask::createRangeReaders(const Readers & task_readers, const PrewhereExprInfo & prewhere_actions)
+MergeTreeReadTask::createRangeReaders(
+    const Readers & task_readers,
+    const PrewhereExprInfo & prewhere_actions,
+    const PrewhereSelectivityCacheWriterPtr & selectivity_cache_writer)
 {
     MergeTreeReadTask::RangeReaders new_range_readers;
     if (prewhere_actions.steps.size() != task_readers.prewhere.size())
@@ -83,7 +86,11 @@ MergeTreeReadTask::createRangeReaders(const Readers & task_readers, const Prewhe
     {
         last_reader = task_readers.main->getColumns().empty() && (i + 1 == prewhere_actions.steps.size());
 
-        MergeTreeRangeReader current_reader(task_readers.prewhere[i].get(), prev_reader, prewhere_actions.steps[i].get(), last_reader);
+        /// The writer is attached to the first reader in the chain: it is the one that starts
+        /// the reading and creates the ReadResult the whole chain operates on.
+        MergeTreeRangeReader current_reader(
+            task_readers.prewhere[i].get(), prev_reader, prewhere_actions.steps[i].get(), last_reader,
+            i == 0 ? selectivity_cache_writer : nullptr);
 
         new_range_readers.prewhere.push_back(std::move(current_reader));
         prev_reader = &new_range_readers.prewhere.back();
@@ -91,7 +98,7 @@ MergeTreeReadTask::createRangeReaders(const Readers & task_readers, const Prewhe
 
     if (!last_reader)
     {
-        new_range_readers.main = MergeTreeRangeReader(task_readers.main.get(), prev_reader, nullptr, true);
+        new_range_readers.main = MergeTreeRangeReader(task_readers.main.get(), prev_reader, nullptr, true, nullptr);
     }
     else
     {
@@ -108,9 +115,17 @@ void MergeTreeReadTask::initializeRangeReaders(const PrewhereExprInfo & prewhere
     if (range_readers.main.isInitialized())
         throw Exception(ErrorCodes::LOGICAL_ERROR, "Range reader is already initialized");
 
-    range_readers = createRangeReaders(readers, prewhere_actions);
+    range_readers = createRangeReaders(readers, prewhere_actions, info->selectivity_cache_writer);
 }
 
+/// Source-side block sizing is already adaptive, not static: the size predictor is updated
+/// with the observed byte size and filtration ratio of every produced block, and the next
+/// read is shrunk or grown to hit preferred_block_size_bytes (and the per-column cap), so
+/// wide or poorly-filtered parts converge to smaller row counts on their own. This feedback
+/// loop is deliberately local to the scan: downstream transforms that amplify rows re-chunk
+/// through the squashing transforms instead of steering the source, because in the pull model
+/// a source serves many consumers through forks of the pipeline and there is no single
+/// amplification factor it could obey.
 UInt64 MergeTreeReadTask::estimateNumRows(const BlockSizeParams & params) const
 {
     if (!size_predictor)
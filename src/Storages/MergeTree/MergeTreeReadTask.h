@@ -66,6 +66,12 @@ struct MergeTreeReadTaskInfo
     MergeTreeBlockSizePredictorPtr shared_size_predictor;
     /// TODO: comment
     VirtualFields const_virtual_fields;
+    /// The minimal task size for this part based on the size of the queried columns
+    /// on the storage where the part resides.
+    size_t min_marks_per_task = 0;
+    /// If not nullptr, granules of this part entirely filtered out by PREWHERE
+    /// are recorded in the selectivity cache.
+    PrewhereSelectivityCacheWriterPtr selectivity_cache_writer;
 };
 
 using MergeTreeReadTaskInfoPtr = std::shared_ptr<const MergeTreeReadTaskInfo>;
@@ -138,7 +144,10 @@ public:
     Readers releaseReaders() { return std::move(readers); }
 
     static Readers createReaders(const MergeTreeReadTaskInfoPtr & read_info, const Extras & extras, const MarkRanges & ranges);
-    static RangeReaders createRangeReaders(const Readers & readers, const PrewhereExprInfo & prewhere_actions);
+    static RangeReaders createRangeReaders(
+        const Readers & readers,
+        const PrewhereExprInfo & prewhere_actions,
+        const PrewhereSelectivityCacheWriterPtr & selectivity_cache_writer);
 
 private:
     UInt64 estimateNumRows(const BlockSizeParams & params) const;
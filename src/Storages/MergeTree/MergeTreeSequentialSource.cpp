@@ -83,6 +83,13 @@ private:
     /// current row at which we stop reading
     size_t current_row = 0;
 
+    /// Number of rows already read from the current mark, if the granule is read in several steps.
+    size_t rows_read_in_current_mark = 0;
+
+    /// If non-zero, read at most that many rows at once, so that parts with very large rows
+    /// do not produce blocks much larger than merge_max_block_size_bytes.
+    size_t max_rows_per_read = 0;
+
     /// Closes readers and unlock part locks
     void finish();
 };
@@ -154,6 +161,12 @@ MergeTreeSequentialSource::MergeTreeSequentialSource(
     /// It does not make sense to use pthread_threadpool for background merges/mutations
     /// And also to preserve backward compatibility
     read_settings.local_fs_method = LocalFSReadMethod::pread;
+
+    /// The access pattern is strictly sequential within every column file, but the reader
+    /// alternates between the files, so tell the OS explicitly about upcoming reads (with `pread`
+    /// the prefetch is a posix_fadvise(POSIX_FADV_WILLNEED) hint), to keep the device busy while
+    /// already fetched data is being decompressed and merged.
+    read_settings.local_fs_prefetch = true;
     if (read_with_direct_io)
         read_settings.direct_io_threshold = 1;
 
@@ -179,6 +192,22 @@ MergeTreeSequentialSource::MergeTreeSequentialSource(
     if (!mark_ranges)
         mark_ranges.emplace(MarkRanges{MarkRange(0, data_part->getMarksCount())});
 
+    /// A whole granule of a part with very large rows (e.g. huge arrays) may be several gigabytes,
+    /// especially with non-adaptive index granularity. Estimate the average row size and limit the
+    /// number of rows per read, so that the size of a block stays around merge_max_block_size_bytes
+    /// regardless of the row size.
+    if (size_t merge_max_block_size_bytes = storage.getSettings()->merge_max_block_size_bytes;
+        merge_max_block_size_bytes != 0 && data_part->rows_count != 0)
+    {
+        size_t sum_uncompressed_bytes = 0;
+        for (const auto & column : columns_for_reader)
+            sum_uncompressed_bytes += data_part->getColumnSize(column.name).data_uncompressed;
+
+        size_t avg_row_bytes = sum_uncompressed_bytes / data_part->rows_count;
+        if (avg_row_bytes != 0)
+            max_rows_per_read = std::max<size_t>(1, merge_max_block_size_bytes / avg_row_bytes);
+    }
+
     reader = data_part->getReader(
         columns_for_reader,
         storage_snapshot,
@@ -233,8 +262,12 @@ try
 
     if (!isCancelled() && current_row < data_part->rows_count)
     {
-        size_t rows_to_read = data_part->index_granularity.getMarkRows(current_mark);
-        bool continue_reading = (current_mark != 0);
+        size_t granule_rows = data_part->index_granularity.getMarkRows(current_mark);
+        size_t rows_to_read = granule_rows - rows_read_in_current_mark;
+        if (max_rows_per_read)
+            rows_to_read = std::min(rows_to_read, max_rows_per_read);
+
+        bool continue_reading = (current_mark != 0 || rows_read_in_current_mark != 0);
 
         const auto & sample = reader->getColumns();
         Columns columns(sample.size());
@@ -246,7 +279,13 @@ try
             reader->fillVirtualColumns(columns, rows_read);
 
             current_row += rows_read;
-            current_mark += (rows_to_read == rows_read);
+            rows_read_in_current_mark += rows_read;
+
+            if (rows_read_in_current_mark == granule_rows)
+            {
+                ++current_mark;
+                rows_read_in_current_mark = 0;
+            }
 
             bool should_evaluate_missing_defaults = false;
             reader->fillMissingColumns(columns, should_evaluate_missing_defaults, rows_read);
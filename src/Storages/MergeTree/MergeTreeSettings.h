@@ -47,6 +47,8 @@ struct Settings;
     /** Merge settings. */ \
     M(UInt64, merge_max_block_size, 8192, "How many rows in blocks should be formed for merge operations. By default has the same value as `index_granularity`.", 0) \
     M(UInt64, merge_max_block_size_bytes, 10 * 1024 * 1024, "How many bytes in blocks should be formed for merge operations. By default has the same value as `index_granularity_bytes`.", 0) \
+    M(UInt64, merge_max_threads, 1, "Maximum number of threads for executing the pipeline of a single merge. With the default of 1 the whole merge runs on one thread. Greater values allow reading and decompressing the source parts concurrently with each other and with merging and writing the result.", 0) \
+    M(MergeSelectorAlgorithm, merge_selector_algorithm, MergeSelectorAlgorithm::Simple, "The algorithm to select parts for background merges. 'Simple' balances the number of parts against write amplification. 'Level' merges fixed-size groups of parts of the same level, LSM-style: it rewrites data fewer times on insert-heavy tables at the cost of keeping more parts.", 0) \
     M(UInt64, max_bytes_to_merge_at_max_space_in_pool, 150ULL * 1024 * 1024 * 1024, "Maximum in total size of parts to merge, when there are maximum free threads in background pool (or entries in replication queue).", 0) \
     M(UInt64, max_bytes_to_merge_at_min_space_in_pool, 1024 * 1024, "Maximum in total size of parts to merge, when there are minimum free threads in background pool (or entries in replication queue).", 0) \
     M(UInt64, max_replicated_merges_in_queue, 1000, "How many tasks of merging and mutating parts are allowed simultaneously in ReplicatedMergeTree queue.", 0) \
@@ -207,6 +209,8 @@ struct Settings;
     M(UInt64, marks_compress_block_size, 65536, "Mark compress block size, the actual size of the block to compress.", 0) \
     M(UInt64, primary_key_compress_block_size, 65536, "Primary compress block size, the actual size of the block to compress.", 0) \
     M(Bool, primary_key_lazy_load, true, "Load primary key in memory on first use instead of on table initialization. This can save memory in the presence of a large number of tables.", 0) \
+    M(Bool, primary_key_preload_in_background, false, "Load primary keys of active data parts in memory in background after the table startup. Unlike primary_key_lazy_load = 0 it does not delay the table initialization, and unlike the default lazy loading the first queries do not pay the loading cost. Takes effect only together with primary_key_lazy_load.", 0) \
+    M(Bool, primary_key_compress_strings_in_memory, false, "Keep String columns of the primary index dictionary-encoded in memory when most of their values repeat between adjacent marks. Saves memory for wide string keys at the cost of a small overhead on index load.", 0) \
     M(Float, primary_key_ratio_of_unique_prefix_values_to_skip_suffix_columns, 0.9f, "If the value of a column of the primary key in data part changes at least in this ratio of times, skip loading next columns in memory. This allows to save memory usage by not loading useless columns of the primary key.", 0) \
     /** Projection settings. */ \
     M(UInt64, max_projections, 25, "The maximum number of merge tree projections.", 0) \
@@ -1,8 +1,13 @@
 #include <Storages/MergeTree/MergeTreeSink.h>
+#include <Storages/MergeTree/MergeTreePartition.h>
 #include <Storages/StorageMergeTree.h>
+#include <Interpreters/Context.h>
 #include <Interpreters/PartLog.h>
 #include <DataTypes/ObjectUtils.h>
 #include <Common/ProfileEventsScope.h>
+#include <Common/threadPoolCallbackRunner.h>
+
+#include <map>
 
 namespace ProfileEvents
 {
@@ -25,6 +30,12 @@ struct MergeTreeSink::DelayedChunk
     std::vector<Partition> partitions;
 };
 
+struct MergeTreeSink::PendingBlocks
+{
+    /// Ordered map, so that the parts of one INSERT are formed in a deterministic order.
+    std::map<String, BlockWithPartition> by_partition_id;
+};
+
 
 MergeTreeSink::~MergeTreeSink() = default;
 
@@ -51,6 +62,17 @@ void MergeTreeSink::onStart()
 
 void MergeTreeSink::onFinish()
 {
+    if (pending_blocks)
+    {
+        BlocksWithPartition remaining;
+        remaining.reserve(pending_blocks->by_partition_id.size());
+        for (auto & [partition_id, block] : pending_blocks->by_partition_id)
+            remaining.emplace_back(std::move(block));
+
+        pending_blocks.reset();
+        writePartBlocks(std::move(remaining));
+    }
+
     finishDelayedChunk();
 }
 
@@ -65,6 +87,60 @@ void MergeTreeSink::consume(Chunk chunk)
 
     auto part_blocks = MergeTreeDataWriter::splitBlockIntoParts(std::move(block), max_parts_per_block, metadata_snapshot, context);
 
+    if (context->getSettingsRef().squash_partition_blocks_on_insert)
+        part_blocks = squashWithPendingBlocks(std::move(part_blocks));
+
+    writePartBlocks(std::move(part_blocks));
+
+    ++num_blocks_processed;
+}
+
+BlocksWithPartition MergeTreeSink::squashWithPendingBlocks(BlocksWithPartition && part_blocks)
+{
+    const Settings & settings = context->getSettingsRef();
+    const Block & partition_key_sample = metadata_snapshot->getPartitionKey().sample_block;
+
+    if (!pending_blocks)
+        pending_blocks = std::make_unique<PendingBlocks>();
+
+    BlocksWithPartition ready_blocks;
+    for (auto & current_block : part_blocks)
+    {
+        /// Blocks of async inserts carry per-block offsets and deduplication tokens,
+        /// they cannot be regrouped.
+        if (!current_block.offsets.empty())
+        {
+            ready_blocks.emplace_back(std::move(current_block));
+            continue;
+        }
+
+        auto partition_id = MergeTreePartition(current_block.partition).getID(partition_key_sample);
+        auto [it, inserted] = pending_blocks->by_partition_id.try_emplace(std::move(partition_id), std::move(current_block));
+        if (!inserted)
+        {
+            auto & pending = it->second.block;
+            auto mutable_columns = pending.mutateColumns();
+            for (size_t i = 0; i < mutable_columns.size(); ++i)
+                mutable_columns[i]->insertRangeFrom(*current_block.block.getByPosition(i).column, 0, current_block.block.rows());
+            pending.setColumns(std::move(mutable_columns));
+        }
+
+        /// A partition that accumulated a block of the full insert block size would not be
+        /// squashed any further, write it out right away to limit memory usage.
+        const auto & accumulated = it->second.block;
+        if ((settings.min_insert_block_size_rows && accumulated.rows() >= settings.min_insert_block_size_rows)
+            || (settings.min_insert_block_size_bytes && accumulated.bytes() >= settings.min_insert_block_size_bytes))
+        {
+            ready_blocks.emplace_back(std::move(it->second));
+            pending_blocks->by_partition_id.erase(it);
+        }
+    }
+
+    return ready_blocks;
+}
+
+void MergeTreeSink::writePartBlocks(BlocksWithPartition && part_blocks)
+{
     using DelayedPartitions = std::vector<MergeTreeSink::DelayedChunk::Partition>;
     DelayedPartitions partitions;
 
@@ -147,8 +223,6 @@ void MergeTreeSink::consume(Chunk chunk)
     finishDelayedChunk();
     delayed_chunk = std::make_unique<MergeTreeSink::DelayedChunk>();
     delayed_chunk->partitions = std::move(partitions);
-
-    ++num_blocks_processed;
 }
 
 void MergeTreeSink::finishDelayedChunk()
@@ -156,6 +230,24 @@ void MergeTreeSink::finishDelayedChunk()
     if (!delayed_chunk)
         return;
 
+    /// Finalization of a part does the fsyncs deferred by writeTempPart when fsync_after_insert
+    /// is set. The parts of the chunk are independent, so issue their fsyncs as one batch and
+    /// wait for all of them, instead of paying the full fsync latency once per part in the
+    /// commit loop below.
+    if (storage.getSettings()->fsync_after_insert && delayed_chunk->partitions.size() > 1)
+    {
+        ThreadPoolCallbackRunnerLocal<void> runner(context->getThreadPoolWriter(), "PartsFinalize");
+        for (auto & partition : delayed_chunk->partitions)
+        {
+            runner([&partition]
+            {
+                ProfileEventsScope scoped_attach(&partition.part_counters);
+                partition.temp_part.finalize();
+            });
+        }
+        runner.waitForAllToFinishAndRethrowFirstError();
+    }
+
     for (auto & partition : delayed_chunk->partitions)
     {
         ProfileEventsScope scoped_attach(&partition.part_counters);
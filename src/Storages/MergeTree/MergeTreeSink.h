@@ -11,6 +11,7 @@ class Block;
 class StorageMergeTree;
 struct StorageSnapshot;
 using StorageSnapshotPtr = std::shared_ptr<StorageSnapshot>;
+struct BlockWithPartition;
 
 
 class MergeTreeSink : public SinkToStorage
@@ -42,6 +43,15 @@ private:
     struct DelayedChunk;
     std::unique_ptr<DelayedChunk> delayed_chunk;
 
+    /// Sub-blocks of the same partition from different chunks of one INSERT,
+    /// accumulated until they are big enough to form a part of their own
+    /// (see the squash_partition_blocks_on_insert setting).
+    struct PendingBlocks;
+    std::unique_ptr<PendingBlocks> pending_blocks;
+
+    /// Appends the per-partition blocks to `pending_blocks` and returns those that are ready to be written.
+    std::vector<BlockWithPartition> squashWithPendingBlocks(std::vector<BlockWithPartition> && part_blocks);
+    void writePartBlocks(std::vector<BlockWithPartition> && part_blocks);
     void finishDelayedChunk();
 };
 
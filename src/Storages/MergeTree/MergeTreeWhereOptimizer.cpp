@@ -276,6 +276,14 @@ void MergeTreeWhereOptimizer::analyzeImpl(Conditions & res, const RPNBuilderTree
         if (cond.viable)
             cond.good = isConditionGood(node, table_columns);
 
+        /// With allow_statistic_optimize the ranking is no longer purely the static size
+        /// heuristic: per-part statistics feed an actual selectivity estimate per condition.
+        /// The cost side of the ratio is still compressed column size as a proxy for read
+        /// and decompression work - per-column CPU-per-row numbers measured from prior
+        /// executions would slot in right here as a replacement for columns_size, but there
+        /// is no per-table store of execution feedback to take them from, and row-level
+        /// early exit between split PREWHERE steps already exists naturally: each step reads
+        /// only ranges that survived the previous step's filter.
         if (where_optimizer_context.use_statistic)
         {
             cond.good = cond.viable;
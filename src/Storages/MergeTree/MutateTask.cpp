@@ -33,6 +33,10 @@
 namespace ProfileEvents
 {
 extern const Event MutateTaskProjectionsCalculationMicroseconds;
+extern const Event MutationTotalParts;
+extern const Event MutationUntouchedParts;
+extern const Event MutationAllPartColumns;
+extern const Event MutationSomePartColumns;
 }
 
 namespace CurrentMetrics
@@ -2097,6 +2101,7 @@ bool MutateTask::prepare()
             "This is a bug.", ctx->future_part->parts.size());
 
     ctx->num_mutations = std::make_unique<CurrentMetrics::Increment>(CurrentMetrics::PartMutation);
+    ProfileEvents::increment(ProfileEvents::MutationTotalParts);
 
     auto context_for_reading = Context::createCopy(ctx->context);
 
@@ -2131,6 +2136,7 @@ bool MutateTask::prepare()
             files_to_copy_instead_of_hardlinks.insert(IMergeTreeDataPart::FILE_FOR_REFERENCES_CHECK);
 
         LOG_TRACE(ctx->log, "Part {} doesn't change up to mutation version {}", ctx->source_part->name, ctx->future_part->part_info.mutation);
+        ProfileEvents::increment(ProfileEvents::MutationUntouchedParts);
         std::string prefix;
         if (ctx->need_prefix)
             prefix = "tmp_clone_";
@@ -2258,6 +2264,7 @@ bool MutateTask::prepare()
         /// The blobs have to be removed along with the part, this temporary part owns them and does not share them yet.
         ctx->new_data_part->remove_tmp_policy = IMergeTreeDataPart::BlobsRemovalPolicyForTemporaryParts::REMOVE_BLOBS;
 
+        ProfileEvents::increment(ProfileEvents::MutationAllPartColumns);
         task = std::make_unique<MutateAllPartColumnsTask>(ctx);
     }
     else /// TODO: check that we modify only non-key columns in this case.
@@ -2297,6 +2304,7 @@ bool MutateTask::prepare()
         /// Keeper has to be asked with unlock request to release the references to the blobs
         ctx->new_data_part->remove_tmp_policy = IMergeTreeDataPart::BlobsRemovalPolicyForTemporaryParts::ASK_KEEPER;
 
+        ProfileEvents::increment(ProfileEvents::MutationSomePartColumns);
         task = std::make_unique<MutateSomePartColumnsTask>(ctx);
     }
 
@@ -252,6 +252,16 @@ private:
     ///
     /// So, segments always move in one direction down this path (possibly skipping some stops):
     /// `all_parts_to_read` -> `distribution_by_hash_queue[owner]` -> `distribution_by_hash_queue[stealer_by_hash]` -> `ranges_for_stealing_queue`
+    ///
+    /// Straggler behavior follows from the pull model: segments are handed out only in
+    /// response to read requests, so a slow replica starves itself of new work automatically
+    /// and fast replicas drain its unclaimed segments through the stealing queues - per-replica
+    /// throughput tracking would just re-derive what demand already expresses. The remaining
+    /// exposure is segments a laggard has been GRANTED but not finished; those cannot be
+    /// revoked or speculatively duplicated under this protocol because delivered result blocks
+    /// are not deduplicable - first-complete-wins would require the initiator to track and
+    /// discard row ranges per segment. Keeping grant sizes small (mark_segment_size) is what
+    /// bounds that window.
 
     /// We take the set of parts announced by this replica as the working set for the whole query.
     /// For this replica we know for sure that
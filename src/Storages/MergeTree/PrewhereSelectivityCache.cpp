@@ -0,0 +1,65 @@
+#include <Storages/MergeTree/PrewhereSelectivityCache.h>
+
+#include <Columns/ColumnConst.h>
+#include <Common/assert_cast.h>
+#include <Functions/IFunction.h>
+#include <Interpreters/ActionsDAG.h>
+#include <Storages/SelectQueryInfo.h>
+
+namespace DB
+{
+
+template class CacheBase<UInt128, PrewhereSelectivityEntry, UInt128TrivialHash, PrewhereSelectivityWeightFunction>;
+
+namespace
+{
+
+/// Hashes the structure of the DAG together with the values of its constants.
+/// dumpDAG() prints constants by type only, and runtime-folded constants like
+/// now() - 3600 or currentUser() keep a stable result name, so the values
+/// themselves must be part of the key. Returns false if the DAG contains a
+/// non-deterministic function: such a condition may select different rows on
+/// each execution and cannot identify a cache entry.
+bool updateHashWithCondition(const ActionsDAG & dag, SipHash & hash)
+{
+    hash.update(dag.dumpDAG());
+
+    for (const auto & node : dag.getNodes())
+    {
+        if (node.type == ActionsDAG::ActionType::FUNCTION
+            && node.function_base && !node.function_base->isDeterministic())
+            return false;
+
+        if (node.column && isColumnConst(*node.column))
+            assert_cast<const ColumnConst &>(*node.column).getDataColumn().updateHashWithValue(0, hash);
+    }
+
+    return true;
+}
+
+}
+
+std::optional<UInt64> PrewhereSelectivityCache::conditionHash(const PrewhereInfo & prewhere_info)
+{
+    SipHash hash;
+
+    if (prewhere_info.prewhere_actions)
+    {
+        if (!updateHashWithCondition(*prewhere_info.prewhere_actions, hash))
+            return std::nullopt;
+
+        hash.update(prewhere_info.prewhere_column_name);
+    }
+
+    if (prewhere_info.row_level_filter)
+    {
+        if (!updateHashWithCondition(*prewhere_info.row_level_filter, hash))
+            return std::nullopt;
+
+        hash.update(prewhere_info.row_level_column_name);
+    }
+
+    return hash.get64();
+}
+
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <Common/CacheBase.h>
+#include <Common/HashTable/Hash.h>
+#include <Common/ProfileEvents.h>
+#include <Common/SipHash.h>
+
+namespace ProfileEvents
+{
+    extern const Event PrewhereSelectivityCacheHits;
+    extern const Event PrewhereSelectivityCacheMisses;
+}
+
+namespace DB
+{
+
+struct PrewhereInfo;
+
+/// Set of granules of one immutable data part which are known to contain no rows matching
+/// a fixed PREWHERE condition. Filled incrementally by concurrent reading threads.
+struct PrewhereSelectivityEntry
+{
+    explicit PrewhereSelectivityEntry(size_t marks_count) : failing_marks(marks_count) {}
+
+    std::mutex mutex;
+    /// failing_marks[mark] == true means that the granule starting at `mark` has no matching rows.
+    std::vector<bool> failing_marks;
+};
+
+struct PrewhereSelectivityWeightFunction
+{
+    /// We spent additional bytes on key in hashmap, linked lists, shared pointers, etc ...
+    static constexpr size_t ENTRY_OVERHEAD = 128;
+
+    size_t operator()(const PrewhereSelectivityEntry & entry) const
+    {
+        return entry.failing_marks.capacity() / 8 + ENTRY_OVERHEAD;
+    }
+};
+
+extern template class CacheBase<UInt128, PrewhereSelectivityEntry, UInt128TrivialHash, PrewhereSelectivityWeightFunction>;
+/** Cache of PREWHERE selectivity at the granule level: (data part, condition) -> bitmap of
+  * granules which were read by some query and turned out to contain no matching rows.
+  * Since data parts are immutable, repeated queries with the same PREWHERE condition can skip
+  * these granules without reading and decompressing them. It is populated by MergeTreeRangeReader
+  * and consulted when mark ranges of a part are selected for reading.
+  *
+  * The (immutable part, expression hash) keying used here is the general recipe for caching
+  * any derived result of a part, and this cache deliberately stops at in-memory bitmaps.
+  * Persisting heavier derivations (e.g. computed columns for expensive deterministic
+  * expressions) as shadow files next to the part does not work without format changes: every
+  * file inside a part directory must be listed in checksums.txt or the part is treated as
+  * broken on load, and replicas fetch parts file-by-file from that same manifest, so an
+  * unmanifested cache file does not survive detach or fetch. On-disk expression
+  * materialization therefore belongs to the schema (MATERIALIZED columns, projections),
+  * while opportunistic per-part caching stays in memory like this class.
+  */
+class PrewhereSelectivityCache : public CacheBase<UInt128, PrewhereSelectivityEntry, UInt128TrivialHash, PrewhereSelectivityWeightFunction>
+{
+private:
+    using Base = CacheBase<UInt128, PrewhereSelectivityEntry, UInt128TrivialHash, PrewhereSelectivityWeightFunction>;
+
+public:
+    explicit PrewhereSelectivityCache(size_t max_size_in_bytes) : Base(max_size_in_bytes) {}
+
+    /// Calculate key for a (part, condition) pair. The part is identified by the path of its
+    /// storage which is unique across tables and stable for the lifetime of the part.
+    static UInt128 hash(const String & part_path, UInt64 condition_hash)
+    {
+        SipHash hash;
+        hash.update(part_path.data(), part_path.size() + 1);
+        hash.update(condition_hash);
+        return hash.get128();
+    }
+
+    /// Hash of the PREWHERE condition (including the row level filter, if any).
+    /// The values of constants participate in the hash: the DAG dump alone prints constants
+    /// by type only, and constant-folded expressions like now() - 3600 keep a stable result
+    /// name between executions while their value changes. Returns std::nullopt if the
+    /// condition contains a non-deterministic function, in which case it must not be cached.
+    static std::optional<UInt64> conditionHash(const PrewhereInfo & prewhere_info);
+
+    /// Record granules of the part which turned out to contain no matching rows.
+    void addFailingMarks(const Key & key, size_t marks_count, const std::vector<size_t> & marks)
+    {
+        auto [entry, _] = Base::getOrSet(key, [&] { return std::make_shared<PrewhereSelectivityEntry>(marks_count); });
+
+        std::lock_guard lock(entry->mutex);
+        for (size_t mark : marks)
+            if (mark < entry->failing_marks.size())
+                entry->failing_marks[mark] = true;
+    }
+
+    /// Returns the bitmap of failing marks for the given (part, condition),
+    /// or an empty vector if nothing has been cached yet.
+    std::vector<bool> getFailingMarks(const Key & key)
+    {
+        auto entry = Base::get(key);
+        if (!entry)
+        {
+            ProfileEvents::increment(ProfileEvents::PrewhereSelectivityCacheMisses);
+            return {};
+        }
+
+        ProfileEvents::increment(ProfileEvents::PrewhereSelectivityCacheHits);
+
+        std::lock_guard lock(entry->mutex);
+        return entry->failing_marks;
+    }
+};
+
+using PrewhereSelectivityCachePtr = std::shared_ptr<PrewhereSelectivityCache>;
+
+/// Accumulates granules of one data part which were entirely filtered out by PREWHERE
+/// during query execution and records them into the cache.
+class PrewhereSelectivityCacheWriter
+{
+public:
+    PrewhereSelectivityCacheWriter(PrewhereSelectivityCachePtr cache_, UInt128 key_, size_t marks_count_)
+        : cache(std::move(cache_)), key(key_), marks_count(marks_count_)
+    {
+    }
+
+    void addFailingMarks(const std::vector<size_t> & marks) const
+    {
+        cache->addFailingMarks(key, marks_count, marks);
+    }
+
+private:
+    PrewhereSelectivityCachePtr cache;
+    const UInt128 key;
+    const size_t marks_count;
+};
+
+using PrewhereSelectivityCacheWriterPtr = std::shared_ptr<const PrewhereSelectivityCacheWriter>;
+
+}
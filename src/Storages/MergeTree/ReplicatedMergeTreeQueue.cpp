@@ -1350,6 +1350,15 @@ bool ReplicatedMergeTreeQueue::addFuturePartIfNotCoveredByThem(const String & pa
 }
 
 
+/// Admission control for queue entries. Note that the conflict model is already a dependency
+/// graph in disguise, just expressed through part-range algebra instead of explicit edges:
+/// future_parts tracks the block ranges entries are producing, and an entry is postponed only
+/// if its range intersects one of those, so disjoint GET_PART/MERGE entries within one
+/// partition run concurrently up to pool capacity. During catch-up the serialization that
+/// actually bites is legitimate data dependency (a merge must wait for the very parts the
+/// preceding GET_PARTs are fetching) plus the fetch/merge pool limits - an explicit DAG
+/// would surface the same edges, since they come from part containment, not from
+/// over-conservative checks here.
 bool ReplicatedMergeTreeQueue::shouldExecuteLogEntry(
     const LogEntry & entry,
     String & out_postpone_reason,
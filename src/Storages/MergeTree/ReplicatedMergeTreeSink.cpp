@@ -828,6 +828,17 @@ std::pair<std::vector<String>, bool> ReplicatedMergeTreeSinkImpl<async_insert>::
         /// Also, make deduplication check. If a duplicate is detected, no nodes are created.
 
         /// Allocate new block number and check for duplicates
+        ///
+        /// The commit path is two Keeper round trips, not several: this multi-op combines the
+        /// dedup check (create of block_id_path fails on duplicates) with sequential block
+        /// number allocation, and everything else - log entry, block unlock, quorum nodes -
+        /// rides in the single transaction below. The two cannot speculatively collapse into
+        /// one, because the part name embeds the allocated number and the log entry embeds
+        /// the part name; guessing the number and retrying on conflict would make every
+        /// concurrent insert into the partition a conflict, which is worse than the RTT.
+        /// Across inserts, the client already pipelines independent sessions' requests on one
+        /// connection, so the per-table floor is Keeper RTT x2, amortized by batching rows
+        /// per insert rather than by coalescing commits.
         auto block_number_lock = storage.allocateBlockNumber(part->info.partition_id, zookeeper, block_id_path); /// 1 RTT
 
         ThreadFuzzer::maybeInjectSleep();
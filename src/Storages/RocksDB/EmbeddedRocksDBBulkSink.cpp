@@ -0,0 +1,136 @@
+#include <Storages/RocksDB/EmbeddedRocksDBBulkSink.h>
+#include <Storages/RocksDB/StorageEmbeddedRocksDB.h>
+#include <Common/Exception.h>
+#include <Common/getRandomASCIIString.h>
+#include <IO/WriteBufferFromString.h>
+
+#include <filesystem>
+
+#include <rocksdb/db.h>
+#include <rocksdb/options.h>
+#include <rocksdb/sst_file_writer.h>
+
+namespace fs = std::filesystem;
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int ROCKSDB_ERROR;
+}
+
+static const String TMP_INSERT_PREFIX = "tmp_insert_";
+
+EmbeddedRocksDBBulkSink::EmbeddedRocksDBBulkSink(
+    ContextPtr context_,
+    StorageEmbeddedRocksDB & storage_,
+    const StorageMetadataPtr & metadata_snapshot_)
+    : SinkToStorage(metadata_snapshot_->getSampleBlock())
+    , WithContext(context_)
+    , storage(storage_)
+    , metadata_snapshot(metadata_snapshot_)
+{
+    for (const auto & elem : getHeader())
+    {
+        if (elem.name == storage.primary_key)
+            break;
+        ++primary_key_pos;
+    }
+    serializations = getHeader().getSerializations();
+
+    /// SST files are produced next to the database so that ingestion with move_files
+    /// stays a rename instead of a copy.
+    fs::path tmp_dir = fs::path(storage.getDataPaths().front()) / "tmp";
+    fs::create_directories(tmp_dir);
+    tmp_file_prefix = tmp_dir / (TMP_INSERT_PREFIX + getRandomASCIIString(8));
+}
+
+EmbeddedRocksDBBulkSink::~EmbeddedRocksDBBulkSink()
+{
+    /// Files are removed right after ingestion, so anything left matching our prefix
+    /// is garbage from an aborted insert.
+    try
+    {
+        fs::path tmp_dir = fs::path(tmp_file_prefix).parent_path();
+        String file_prefix = fs::path(tmp_file_prefix).filename();
+        if (fs::exists(tmp_dir))
+            for (const auto & entry : fs::directory_iterator(tmp_dir))
+                if (entry.path().filename().string().starts_with(file_prefix))
+                    fs::remove(entry.path());
+    }
+    catch (...)
+    {
+        tryLogCurrentException(__PRETTY_FUNCTION__);
+    }
+}
+
+String EmbeddedRocksDBBulkSink::getTemporarySSTFilePath()
+{
+    return fmt::format("{}_{}.sst", tmp_file_prefix, file_counter++);
+}
+
+void EmbeddedRocksDBBulkSink::consume(Chunk chunk)
+{
+    auto rows = chunk.getNumRows();
+    if (rows == 0)
+        return;
+
+    const auto & columns = chunk.getColumns();
+
+    std::vector<std::pair<String, String>> serialized_rows(rows);
+
+    WriteBufferFromOwnString wb_key;
+    WriteBufferFromOwnString wb_value;
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        wb_key.restart();
+        wb_value.restart();
+
+        for (size_t idx = 0; idx < columns.size(); ++idx)
+            serializations[idx]->serializeBinary(*columns[idx], i, idx == primary_key_pos ? wb_key : wb_value, {});
+
+        serialized_rows[i] = {wb_key.str(), wb_value.str()};
+    }
+
+    /// SstFileWriter requires strictly increasing keys. Sort stably and keep the last
+    /// row of every equal-key run to match the Put semantics of the regular sink.
+    std::stable_sort(
+        serialized_rows.begin(), serialized_rows.end(),
+        [](const auto & lhs, const auto & rhs) { return lhs.first < rhs.first; });
+
+    auto path = getTemporarySSTFilePath();
+
+    rocksdb::SstFileWriter sst_file_writer(rocksdb::EnvOptions{}, storage.rocksdb_ptr->GetOptions());
+    rocksdb::Status status = sst_file_writer.Open(path);
+    if (!status.ok())
+        throw Exception(ErrorCodes::ROCKSDB_ERROR, "RocksDB write error: {}", status.ToString());
+
+    for (size_t i = 0; i < serialized_rows.size(); ++i)
+    {
+        if (i + 1 < serialized_rows.size() && serialized_rows[i].first == serialized_rows[i + 1].first)
+            continue;
+
+        status = sst_file_writer.Put(serialized_rows[i].first, serialized_rows[i].second);
+        if (!status.ok())
+            throw Exception(ErrorCodes::ROCKSDB_ERROR, "RocksDB write error: {}", status.ToString());
+    }
+
+    status = sst_file_writer.Finish();
+    if (!status.ok())
+        throw Exception(ErrorCodes::ROCKSDB_ERROR, "RocksDB write error: {}", status.ToString());
+
+    rocksdb::IngestExternalFileOptions ingest_options;
+    ingest_options.move_files = true;
+
+    status = storage.rocksdb_ptr->IngestExternalFile({path}, ingest_options);
+    if (!status.ok())
+        throw Exception(ErrorCodes::ROCKSDB_ERROR, "RocksDB write error: {}", status.ToString());
+
+    /// With move_files ingestion leaves a hard link behind on filesystems that support it.
+    if (fs::exists(path))
+        fs::remove(path);
+}
+
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Processors/Sinks/SinkToStorage.h>
+#include <Interpreters/Context_fwd.h>
+
+
+namespace DB
+{
+
+class StorageEmbeddedRocksDB;
+struct StorageInMemoryMetadata;
+using StorageMetadataPtr = std::shared_ptr<const StorageInMemoryMetadata>;
+
+/// Sink for bulk loading into StorageEmbeddedRocksDB (enabled with the rocksdb_bulk_insert
+/// setting). Instead of going through memtables and the WAL, every consumed chunk is sorted
+/// by serialized key, written to an SST file with rocksdb::SstFileWriter and handed to
+/// IngestExternalFile, which places it directly into the LSM tree. This skips both the write
+/// amplification of flushes and the compaction storms that a huge memtable-path load causes.
+/// The trade-off is that rows become visible per ingested file rather than per write batch,
+/// which is fine for INSERT SELECT style rebuilds this is meant for. Not used for tables
+/// with TTL: the TTL layer appends a timestamp suffix to values on the write path, and SST
+/// files built here would miss it.
+class EmbeddedRocksDBBulkSink : public SinkToStorage, public WithContext
+{
+public:
+    EmbeddedRocksDBBulkSink(
+        ContextPtr context_,
+        StorageEmbeddedRocksDB & storage_,
+        const StorageMetadataPtr & metadata_snapshot_);
+
+    ~EmbeddedRocksDBBulkSink() override;
+
+    void consume(Chunk chunk) override;
+
+    String getName() const override { return "EmbeddedRocksDBBulkSink"; }
+
+private:
+    /// Returns a path for the next SST file, unique across concurrent sinks of one table.
+    String getTemporarySSTFilePath();
+
+    StorageEmbeddedRocksDB & storage;
+    StorageMetadataPtr metadata_snapshot;
+    size_t primary_key_pos = 0;
+    Serializations serializations;
+
+    String tmp_file_prefix;
+    size_t file_counter = 0;
+};
+
+}
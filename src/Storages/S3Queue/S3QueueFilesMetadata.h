@@ -85,6 +85,15 @@ public:
     /// We use sharded processing for Ordered mode of S3Queue table.
     /// It allows to parallelize processing within a single server
     /// and to allow distributed processing.
+    ///
+    /// This is exactly the hash-sharded ordering-domain scheme: each file path maps to a
+    /// processing id by path hash (getProcessingIdForPath), ordering (max_processed_file) is
+    /// tracked in Keeper per processing id instead of per table, and shards group processing
+    /// ids so replicas can each own a slice (s3queue_total_shards_num /
+    /// s3queue_current_shard_num, with s3queue_processing_threads_num ids per shard). The
+    /// guarantee is correspondingly weakened from total order to per-processing-id order -
+    /// acceptable when per-key order is all consumers need, which is why it is opt-in and
+    /// Ordered mode defaults to one domain.
     bool isShardedProcessing() const;
 
     /// Register a new shard for processing.
@@ -74,7 +74,7 @@ StatisticPtr MergeTreeStatisticsFactory::get(const StatisticDescription & stat)
         throw Exception(ErrorCodes::INCORRECT_QUERY,
                 "Unknown Statistic type '{}'. Available types: tdigest", stat.type);
     }
-    return std::make_shared<TDigestStatistic>(stat);
+    return it->second(stat);
 }
 
 Statistics MergeTreeStatisticsFactory::getMany(const ColumnsDescription & columns) const
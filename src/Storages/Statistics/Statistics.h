@@ -28,6 +28,13 @@ using Statistics = std::vector<StatisticPtr>;
 /// Statistic contains the distribution of values in a column.
 /// right now we support
 /// - tdigest
+///
+/// New sketch kinds (equi-depth histograms, distinct-count sketches) plug in through the
+/// factory below: per-part persistence (statistic_*.stat files), rebuild on merge and the
+/// serialize/deserialize contract are already generic over IStatistic. The consumer side is
+/// the narrow part - only ConditionSelectivityEstimator reads statistics today, so wider use
+/// (join ordering, aggregation sizing) is about surfacing estimates to the planner, not about
+/// this interface.
 class IStatistic
 {
 public:
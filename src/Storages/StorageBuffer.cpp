@@ -462,6 +462,18 @@ void StorageBuffer::read(
 }
 
 
+/// On redesigning the buffer as per-core lock-free segments: the append below is already
+/// columnar (insertRangeFrom per column, no row-by-row rebuild), and insert contention is
+/// already spread by num_shards - BufferSink starts at getThreadId() % num_shards and
+/// try-locks around the ring, so writers only collide when every shard is mid-flush or
+/// mid-read. The locks that remain are load-bearing: SELECT must see a consistent block
+/// (reads copy under the shard lock precisely so that writers are blocked only for the copy,
+/// not for the downstream query), and flush must atomically swap the block out against
+/// concurrent appends. Epoch-based reclamation would buy appends concurrent with the flush
+/// *write*, but the flush write happens outside the lock already (the block is detached
+/// first). If a workload outgrows this, the answer in this codebase is not a fancier Buffer
+/// but async_insert, which batches on the server without per-table buffer state, keeps data
+/// after a crash, and does not degrade SELECTs with buffer merges.
 static void appendBlock(LoggerPtr log, const Block & from, Block & to)
 {
     size_t rows = from.rows();
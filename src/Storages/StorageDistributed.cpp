@@ -1624,6 +1624,16 @@ ClusterPtr StorageDistributed::skipUnusedShardsWithAnalyzer(
 
 /// Returns a new cluster with fewer shards if constant folding for `sharding_key_expr` is possible
 /// using constraints from "PREWHERE" and "WHERE" conditions, otherwise returns `nullptr`
+/// Shard pruning is purely algebraic: the WHERE condition is evaluated over the sharding
+/// expression for the finite set of values the condition pins down, so it covers equality and
+/// IN but inherently not open ranges - a range over the raw column corresponds to no
+/// enumerable set of sharding-key values. Range pruning would need data summaries instead of
+/// algebra: shards publishing partition minmax digests to the initiator, which is a different
+/// trust and freshness model (summaries go stale with every insert and merge, so a routing
+/// index must be either pessimistically wide or invalidation-driven). Nothing in cluster
+/// discovery carries per-shard data summaries today, which is why this stays predicate-only;
+/// the time-sharded use case is served by making the time bucket the sharding key itself so
+/// range predicates collapse to IN over buckets.
 ClusterPtr StorageDistributed::skipUnusedShards(
     ClusterPtr cluster,
     const SelectQueryInfo & query_info,
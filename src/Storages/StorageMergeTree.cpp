@@ -154,6 +154,7 @@ void StorageMergeTree::startup()
         background_operations_assignee.start();
         startBackgroundMovesIfNeeded();
         startOutdatedDataPartsLoadingTask();
+        startPrimaryIndexPreloadTask();
     }
     catch (...)
     {
@@ -180,6 +181,7 @@ void StorageMergeTree::shutdown(bool)
         return;
 
     stopOutdatedDataPartsLoadingTask();
+    stopPrimaryIndexPreloadTask();
 
     /// Unlock all waiting mutations
     {
@@ -1331,6 +1333,11 @@ MergeMutateSelectedEntryPtr StorageMergeTree::selectPartsToMutate(
             auto new_part_info = part->info;
             new_part_info.mutation = last_mutation_to_apply->first;
 
+            size_t num_squashed_mutations = std::distance(mutations_begin_it, last_mutation_to_apply) + 1;
+            if (num_squashed_mutations > 1)
+                LOG_TRACE(log, "Will apply {} mutations up to version {} to part {} in one rewrite",
+                    num_squashed_mutations, last_mutation_to_apply->first, part->name);
+
             future_part->parts.push_back(part);
             future_part->part_info = new_part_info;
             future_part->name = part->getNewName(new_part_info);
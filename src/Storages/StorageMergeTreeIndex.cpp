@@ -79,7 +79,10 @@ protected:
             if (index_header.has(column_name))
             {
                 size_t index_position = index_header.getPositionByName(column_name);
-                result_columns[pos] = index[index_position];
+                /// The loaded index may keep String key columns LowCardinality-encoded in memory
+                /// (see primary_key_compress_strings_in_memory), while the header declares the
+                /// original type of the column.
+                result_columns[pos] = index[index_position]->convertToFullColumnIfLowCardinality();
             }
             else if (column_name == part_name_column.name)
             {
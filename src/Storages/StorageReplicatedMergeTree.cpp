@@ -5134,6 +5134,7 @@ void StorageReplicatedMergeTree::startup()
 {
     LOG_TRACE(log, "Starting up table");
     startOutdatedDataPartsLoadingTask();
+    startPrimaryIndexPreloadTask();
     if (attach_thread)
     {
         attach_thread->start();
@@ -5337,6 +5338,7 @@ void StorageReplicatedMergeTree::shutdown(bool)
 
     session_expired_callback_handler.reset();
     stopOutdatedDataPartsLoadingTask();
+    stopPrimaryIndexPreloadTask();
 
     partialShutdown();
 
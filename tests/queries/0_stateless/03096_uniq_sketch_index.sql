@@ -0,0 +1,33 @@
+SET allow_experimental_uniq_sketch_index = 1;
+
+DROP TABLE IF EXISTS t_uniq_sketch;
+
+CREATE TABLE t_uniq_sketch
+(
+    d Date,
+    user_id UInt64,
+    INDEX idx_uniq user_id TYPE uniq_sketch GRANULARITY 1
+)
+ENGINE = MergeTree ORDER BY d;
+
+INSERT INTO t_uniq_sketch SELECT toDate('2020-01-01') + number % 10, number % 1000 FROM numbers(100000);
+
+SELECT count() FROM t_uniq_sketch;
+SELECT uniq(user_id) FROM t_uniq_sketch;
+
+ALTER TABLE t_uniq_sketch MATERIALIZE INDEX idx_uniq SETTINGS mutations_sync = 2;
+OPTIMIZE TABLE t_uniq_sketch FINAL;
+
+-- The index never prunes granules, queries must work as usual.
+SELECT count() FROM t_uniq_sketch WHERE user_id = 1;
+
+SELECT name, type FROM system.data_skipping_indices WHERE database = currentDatabase() AND table = 't_uniq_sketch';
+
+-- The index does not take arguments.
+ALTER TABLE t_uniq_sketch ADD INDEX idx_bad user_id TYPE uniq_sketch(3) GRANULARITY 1; -- { serverError BAD_ARGUMENTS }
+
+DROP TABLE t_uniq_sketch;
+
+-- Creation is gated behind the experimental setting.
+SET allow_experimental_uniq_sketch_index = 0;
+CREATE TABLE t_uniq_sketch_denied (x UInt64, INDEX ix x TYPE uniq_sketch GRANULARITY 1) ENGINE = MergeTree ORDER BY x; -- { serverError INCORRECT_QUERY }
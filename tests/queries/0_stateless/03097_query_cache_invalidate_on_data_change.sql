@@ -0,0 +1,28 @@
+-- Tags: no-parallel
+-- Tag no-parallel: Messes with internal cache
+
+SYSTEM DROP QUERY CACHE;
+
+DROP TABLE IF EXISTS tab;
+CREATE TABLE tab (a UInt64) ENGINE = MergeTree ORDER BY a;
+INSERT INTO tab SELECT number FROM numbers(3);
+
+-- Cache the query result
+SELECT count() FROM tab SETTINGS use_query_cache = true, query_cache_invalidate_on_data_change = true;
+
+-- Run the same query again, it is served from the cache
+SELECT count() FROM tab SETTINGS use_query_cache = true, query_cache_invalidate_on_data_change = true;
+
+SELECT count(*) FROM system.query_cache;
+
+SELECT '---';
+
+-- The INSERT creates a new data part, the cached entry must no longer be used despite its TTL not being expired
+INSERT INTO tab SELECT number FROM numbers(3);
+
+SELECT count() FROM tab SETTINGS use_query_cache = true, query_cache_invalidate_on_data_change = true;
+
+SELECT count(*) FROM system.query_cache;
+
+SYSTEM DROP QUERY CACHE;
+DROP TABLE tab;
@@ -0,0 +1,21 @@
+SET allow_experimental_analyzer = 1;
+
+DROP TABLE IF EXISTS tab;
+CREATE TABLE tab (k UInt64) ENGINE = MergeTree ORDER BY k;
+-- key k occurs 2k+1 times, so all counts are distinct and the top 3 is deterministic
+INSERT INTO tab SELECT toUInt64(sqrt(number)) FROM numbers(400);
+
+-- The cardinality is far below the capacity of the space-saving summary, so the rewritten query is exact
+SELECT k, count() AS c FROM tab GROUP BY k ORDER BY c DESC LIMIT 3 SETTINGS optimize_topk_aggregation = 1;
+
+SELECT '---';
+
+-- The rewrite must kick in with the setting and must not without it
+SELECT countIf(explain LIKE '%approx_top_k%') > 0 FROM (EXPLAIN QUERY TREE SELECT k, count() AS c FROM tab GROUP BY k ORDER BY c DESC LIMIT 3 SETTINGS optimize_topk_aggregation = 1);
+SELECT countIf(explain LIKE '%approx_top_k%') > 0 FROM (EXPLAIN QUERY TREE SELECT k, count() AS c FROM tab GROUP BY k ORDER BY c DESC LIMIT 3 SETTINGS optimize_topk_aggregation = 0);
+
+-- Queries which the rewrite cannot preserve are left alone
+SELECT countIf(explain LIKE '%approx_top_k%') > 0 FROM (EXPLAIN QUERY TREE SELECT k, count() AS c FROM tab GROUP BY k HAVING c > 1 ORDER BY c DESC LIMIT 3 SETTINGS optimize_topk_aggregation = 1);
+SELECT countIf(explain LIKE '%approx_top_k%') > 0 FROM (EXPLAIN QUERY TREE SELECT k, count() AS c FROM tab GROUP BY k ORDER BY c DESC LIMIT 3 WITH TIES SETTINGS optimize_topk_aggregation = 1);
+
+DROP TABLE tab;
@@ -0,0 +1,32 @@
+SET join_algorithm = 'hash';
+SET join_runtime_bloom_filter_bytes = 1024;
+
+DROP TABLE IF EXISTS t1;
+DROP TABLE IF EXISTS t2;
+
+CREATE TABLE t1 (k UInt64, v String) ENGINE = MergeTree ORDER BY k;
+CREATE TABLE t2 (k UInt64, v String) ENGINE = MergeTree ORDER BY k;
+
+INSERT INTO t1 SELECT number, 'l' || toString(number) FROM numbers(100);
+INSERT INTO t2 SELECT number * 10, 'r' || toString(number * 10) FROM numbers(10);
+
+-- The filter must not change the result, only skip probe rows early
+SELECT t1.k, t1.v, t2.v FROM t1 INNER JOIN t2 ON t1.k = t2.k ORDER BY t1.k;
+
+SELECT '---';
+
+SELECT count() FROM t1 LEFT SEMI JOIN t2 ON t1.k = t2.k;
+SELECT count() FROM t1 RIGHT JOIN t2 ON t1.k = t2.k;
+SELECT count() FROM t1 LEFT JOIN t2 ON t1.k = t2.k;
+
+SELECT '---';
+
+-- NULL keys never match and may be dropped by the filter
+DROP TABLE IF EXISTS t3;
+CREATE TABLE t3 (k Nullable(UInt64)) ENGINE = MergeTree ORDER BY tuple();
+INSERT INTO t3 VALUES (1), (NULL), (30);
+SELECT t3.k, t2.v FROM t3 INNER JOIN t2 ON t3.k = t2.k ORDER BY t3.k;
+
+DROP TABLE t1;
+DROP TABLE t2;
+DROP TABLE t3;
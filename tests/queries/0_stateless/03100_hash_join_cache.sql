@@ -0,0 +1,33 @@
+-- Tags: no-parallel
+-- no-parallel: measures hits/misses of a server-wide cache
+
+SET allow_experimental_analyzer = 1;
+
+DROP TABLE IF EXISTS fact;
+DROP TABLE IF EXISTS dim;
+
+CREATE TABLE fact (k UInt64, v UInt64) ENGINE = MergeTree ORDER BY k;
+CREATE TABLE dim (k UInt64, name String) ENGINE = MergeTree ORDER BY k;
+
+INSERT INTO fact SELECT number % 4, number FROM numbers(100);
+INSERT INTO dim VALUES (0, 'a'), (1, 'b'), (2, 'c');
+
+SELECT name, sum(v) FROM fact INNER JOIN dim ON fact.k = dim.k GROUP BY name ORDER BY name SETTINGS use_hash_join_cache = 1, log_comment = '03100_first';
+SELECT name, sum(v) FROM fact INNER JOIN dim ON fact.k = dim.k GROUP BY name ORDER BY name SETTINGS use_hash_join_cache = 1, log_comment = '03100_second';
+
+SELECT '---';
+
+-- New data in the dimension table must be picked up, the cache key includes the set of active parts
+INSERT INTO dim VALUES (3, 'd');
+SELECT name, sum(v) FROM fact INNER JOIN dim ON fact.k = dim.k GROUP BY name ORDER BY name SETTINGS use_hash_join_cache = 1, log_comment = '03100_third';
+
+SELECT '---';
+
+SYSTEM FLUSH LOGS;
+SELECT log_comment, ProfileEvents['HashJoinCacheHits'], ProfileEvents['HashJoinCacheMisses']
+FROM system.query_log
+WHERE current_database = currentDatabase() AND type = 'QueryFinish' AND log_comment LIKE '03100%'
+ORDER BY log_comment;
+
+DROP TABLE fact;
+DROP TABLE dim;
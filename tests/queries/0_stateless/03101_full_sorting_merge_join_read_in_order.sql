@@ -0,0 +1,27 @@
+SET allow_experimental_analyzer = 1;
+SET join_algorithm = 'full_sorting_merge';
+SET optimize_read_in_order = 1;
+
+DROP TABLE IF EXISTS t1;
+DROP TABLE IF EXISTS t2;
+
+CREATE TABLE t1 (k UInt64, v UInt64) ENGINE = MergeTree ORDER BY k;
+CREATE TABLE t2 (k UInt64, v UInt64) ENGINE = MergeTree ORDER BY (k, v);
+
+INSERT INTO t1 SELECT number, number * 10 FROM numbers(10);
+INSERT INTO t2 SELECT number * 2, number FROM numbers(10);
+
+SELECT t1.k, t1.v, t2.v FROM t1 JOIN t2 ON t1.k = t2.k ORDER BY t1.k;
+
+SELECT '---';
+
+-- The join keys are a prefix of both table sorting keys: both sides must be read in order
+-- and the sorts before the join must degrade to streaming merges without full sorting
+SELECT countIf(explain LIKE '%ReadType: InOrder%') FROM (EXPLAIN PLAN actions = 1 SELECT t1.k, t1.v, t2.v FROM t1 JOIN t2 ON t1.k = t2.k);
+SELECT countIf(explain LIKE '%MergeSorting%') FROM (EXPLAIN PIPELINE SELECT t1.k, t1.v, t2.v FROM t1 JOIN t2 ON t1.k = t2.k);
+
+-- A join key that is not a prefix of the sorting key still needs a full sort
+SELECT countIf(explain LIKE '%ReadType: InOrder%') FROM (EXPLAIN PLAN actions = 1 SELECT t1.k, t1.v, t2.v FROM t1 JOIN t2 ON t1.v = t2.v);
+
+DROP TABLE t1;
+DROP TABLE t2;
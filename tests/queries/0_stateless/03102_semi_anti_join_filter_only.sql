@@ -0,0 +1,35 @@
+-- SEMI/ANTI LEFT JOIN without columns from the right table goes through the filter-only
+-- fast path in HashJoin, check that it gives the same results as the generic one
+
+SET join_algorithm = 'hash';
+
+DROP TABLE IF EXISTS t1;
+DROP TABLE IF EXISTS t2;
+DROP TABLE IF EXISTS t3;
+DROP TABLE IF EXISTS t_empty;
+
+CREATE TABLE t1 (k UInt64, v UInt64) ENGINE = MergeTree ORDER BY k;
+CREATE TABLE t2 (rk UInt64, rv UInt64) ENGINE = MergeTree ORDER BY rk;
+CREATE TABLE t3 (k Nullable(UInt64), v UInt64) ENGINE = MergeTree ORDER BY v;
+CREATE TABLE t_empty (rk UInt64, rv UInt64) ENGINE = MergeTree ORDER BY rk;
+
+INSERT INTO t1 SELECT number, number * 10 FROM numbers(8);
+INSERT INTO t2 SELECT number * 2, number * 30 FROM numbers(3);
+INSERT INTO t3 VALUES (0, 1), (NULL, 2), (5, 3), (100, 4);
+
+SELECT k, v FROM t1 LEFT SEMI JOIN t2 ON t1.k = t2.rk ORDER BY k;
+SELECT '---';
+SELECT k, v FROM t1 LEFT ANTI JOIN t2 ON t1.k = t2.rk ORDER BY k;
+SELECT '---';
+SELECT k, v FROM t1 LEFT SEMI JOIN t2 ON t1.k = t2.rk OR t1.v = t2.rv ORDER BY k;
+SELECT '---';
+SELECT k, v FROM t1 LEFT SEMI JOIN t_empty ON t1.k = t_empty.rk ORDER BY k;
+SELECT k, v FROM t1 LEFT ANTI JOIN t_empty ON t1.k = t_empty.rk ORDER BY k;
+SELECT '---';
+SELECT k, v FROM t3 LEFT SEMI JOIN t2 ON t3.k = t2.rk ORDER BY v;
+SELECT k, v FROM t3 LEFT ANTI JOIN t2 ON t3.k = t2.rk ORDER BY v;
+
+DROP TABLE t1;
+DROP TABLE t2;
+DROP TABLE t3;
+DROP TABLE t_empty;
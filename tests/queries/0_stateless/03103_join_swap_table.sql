@@ -0,0 +1,25 @@
+SET allow_experimental_analyzer = 1;
+
+DROP TABLE IF EXISTS t_big;
+DROP TABLE IF EXISTS t_small;
+
+CREATE TABLE t_big (k UInt64, v UInt64) ENGINE = MergeTree ORDER BY k;
+CREATE TABLE t_small (k UInt64, v UInt64) ENGINE = MergeTree ORDER BY k;
+
+INSERT INTO t_big SELECT number, number FROM numbers(1000);
+INSERT INTO t_small VALUES (10, 20), (20, 40), (30, 60);
+
+-- The result must not depend on the swap
+SELECT s.v, b.v FROM t_small AS s INNER JOIN t_big AS b ON s.k = b.k ORDER BY s.v SETTINGS query_plan_join_swap_table = 1;
+
+SELECT '---';
+
+-- With the swap enabled the bigger table becomes the probe (left) side
+SELECT extract(explain, 't_big|t_small') FROM (EXPLAIN SELECT count() FROM t_small AS s INNER JOIN t_big AS b ON s.k = b.k SETTINGS query_plan_join_swap_table = 1) WHERE explain LIKE '%ReadFromMergeTree%';
+
+SELECT '---';
+
+SELECT extract(explain, 't_big|t_small') FROM (EXPLAIN SELECT count() FROM t_small AS s INNER JOIN t_big AS b ON s.k = b.k SETTINGS query_plan_join_swap_table = 0) WHERE explain LIKE '%ReadFromMergeTree%';
+
+DROP TABLE t_big;
+DROP TABLE t_small;
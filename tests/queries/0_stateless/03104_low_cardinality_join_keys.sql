@@ -0,0 +1,30 @@
+-- Joins with a LowCardinality probe-side key go through the dictionary-probing
+-- key getter in HashJoin, check the results against all the join kinds it serves
+
+SET join_algorithm = 'hash';
+
+DROP TABLE IF EXISTS lhs;
+DROP TABLE IF EXISTS lhs_n;
+DROP TABLE IF EXISTS rhs;
+
+CREATE TABLE lhs (id UInt64, k LowCardinality(String)) ENGINE = MergeTree ORDER BY id;
+CREATE TABLE lhs_n (id UInt64, k LowCardinality(Nullable(String))) ENGINE = MergeTree ORDER BY id;
+CREATE TABLE rhs (k String, v UInt64) ENGINE = MergeTree ORDER BY k;
+
+INSERT INTO lhs VALUES (1, 'a'), (2, 'b'), (3, 'c'), (4, 'a');
+INSERT INTO lhs_n VALUES (1, 'a'), (2, NULL), (3, 'zz');
+INSERT INTO rhs VALUES ('a', 10), ('b', 20), ('b', 21), ('d', 40);
+
+SELECT id, v FROM lhs INNER JOIN rhs ON lhs.k = rhs.k ORDER BY id, v;
+SELECT '---';
+SELECT id, v FROM lhs LEFT JOIN rhs ON lhs.k = rhs.k ORDER BY id, v;
+SELECT '---';
+SELECT id, v FROM lhs_n LEFT JOIN rhs ON lhs_n.k = rhs.k ORDER BY id, v;
+SELECT '---';
+SELECT id, v FROM lhs_n INNER JOIN rhs ON lhs_n.k = rhs.k ORDER BY id, v;
+SELECT '---';
+SELECT id, v FROM lhs RIGHT JOIN rhs ON lhs.k = rhs.k ORDER BY id, v;
+
+DROP TABLE lhs;
+DROP TABLE lhs_n;
+DROP TABLE rhs;
@@ -0,0 +1,22 @@
+-- Tags: no-parallel-replicas
+
+DROP TABLE IF EXISTS t_lazy_materialization;
+
+CREATE TABLE t_lazy_materialization (k UInt64, v UInt64, s String)
+ENGINE = MergeTree ORDER BY k;
+
+INSERT INTO t_lazy_materialization SELECT number, number * 10, repeat('x', 10) || toString(number) FROM numbers(1000);
+INSERT INTO t_lazy_materialization SELECT number + 1000, number + 100000, toString(number) FROM numbers(1000);
+
+SET query_plan_optimize_lazy_materialization = 1;
+
+SELECT v, s FROM t_lazy_materialization ORDER BY v DESC LIMIT 3;
+SELECT k, s FROM t_lazy_materialization ORDER BY v LIMIT 3;
+
+SELECT trimLeft(explain) FROM (EXPLAIN SELECT v, s FROM t_lazy_materialization ORDER BY v DESC LIMIT 3) WHERE explain LIKE '%LazilyRead%';
+
+SET query_plan_optimize_lazy_materialization = 0;
+
+SELECT v, s FROM t_lazy_materialization ORDER BY v DESC LIMIT 3;
+
+DROP TABLE t_lazy_materialization;
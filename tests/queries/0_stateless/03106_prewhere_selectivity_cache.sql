@@ -0,0 +1,28 @@
+-- Tags: no-parallel-replicas, no-random-merge-tree-settings
+
+DROP TABLE IF EXISTS t_prewhere_selectivity;
+
+CREATE TABLE t_prewhere_selectivity (k UInt64, v UInt64, s String)
+ENGINE = MergeTree ORDER BY k
+SETTINGS index_granularity = 128;
+
+INSERT INTO t_prewhere_selectivity SELECT number, number % 1000, toString(number) FROM numbers(100000);
+
+-- The first run populates the cache with granules that contain no matching rows.
+SELECT count() FROM t_prewhere_selectivity PREWHERE v = 7 SETTINGS use_prewhere_selectivity_cache = 1;
+
+-- The second run must return the same result while skipping the cached granules.
+SELECT count() FROM t_prewhere_selectivity PREWHERE v = 7 SETTINGS use_prewhere_selectivity_cache = 1;
+
+SYSTEM FLUSH LOGS;
+
+SELECT ProfileEvents['PrewhereSelectivityCacheHits'] > 0
+FROM system.query_log
+WHERE current_database = currentDatabase()
+    AND type = 'QueryFinish'
+    AND query LIKE '%PREWHERE v = 7%'
+    AND query NOT LIKE '%query_log%'
+ORDER BY event_time_microseconds DESC
+LIMIT 1;
+
+DROP TABLE t_prewhere_selectivity;
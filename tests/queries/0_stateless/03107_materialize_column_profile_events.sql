@@ -0,0 +1,26 @@
+DROP TABLE IF EXISTS t_materialize_column_events;
+
+CREATE TABLE t_materialize_column_events (id UInt64, s String)
+ENGINE = MergeTree ORDER BY id
+SETTINGS min_bytes_for_wide_part = 0;
+
+INSERT INTO t_materialize_column_events SELECT number, toString(number) FROM numbers(10000);
+
+SET mutations_sync = 2;
+ALTER TABLE t_materialize_column_events ADD COLUMN len UInt64 MATERIALIZED length(s);
+ALTER TABLE t_materialize_column_events MATERIALIZE COLUMN len;
+
+SELECT sum(len) = sum(length(s)) FROM t_materialize_column_events;
+
+SYSTEM FLUSH LOGS;
+
+-- Materializing a column of a wide part must write only the files of the new column
+-- and hardlink the rest instead of rewriting the whole part.
+SELECT
+    ProfileEvents['MutationSomePartColumns'],
+    ProfileEvents['MutationAllPartColumns']
+FROM system.part_log
+WHERE database = currentDatabase() AND table = 't_materialize_column_events' AND event_type = 'MutatePart'
+ORDER BY part_name;
+
+DROP TABLE t_materialize_column_events;
@@ -0,0 +1,17 @@
+DROP TABLE IF EXISTS t_squash_partition_blocks;
+
+CREATE TABLE t_squash_partition_blocks (p UInt64, v UInt64)
+ENGINE = MergeTree PARTITION BY p ORDER BY v;
+
+SYSTEM STOP MERGES t_squash_partition_blocks;
+
+-- The insert is processed in many small blocks, each of them crossing all 10 partitions.
+-- With squashing, one part per partition must be created instead of one part per block and partition.
+INSERT INTO t_squash_partition_blocks SELECT number % 10, number FROM numbers(100000)
+SETTINGS max_block_size = 1000, min_insert_block_size_rows = 0, min_insert_block_size_bytes = 0, squash_partition_blocks_on_insert = 1;
+
+SELECT count() FROM system.parts WHERE database = currentDatabase() AND table = 't_squash_partition_blocks' AND active;
+
+SELECT count(), uniqExact(p), sum(v) FROM t_squash_partition_blocks;
+
+DROP TABLE t_squash_partition_blocks;
@@ -0,0 +1,27 @@
+-- Inserting data already ordered by the sorting key must take the fast path
+-- that verifies sortedness with a linear scan and skips the permutation.
+
+DROP TABLE IF EXISTS t_insert_sorted;
+
+CREATE TABLE t_insert_sorted (k UInt64, v UInt64) ENGINE = MergeTree ORDER BY k;
+
+INSERT INTO t_insert_sorted SELECT number, number * 2 FROM numbers(100000);
+
+-- The same data in reverse order must not be detected as sorted.
+INSERT INTO t_insert_sorted SELECT 1000000 - number, number FROM numbers(100000);
+
+SYSTEM FLUSH LOGS;
+
+SELECT
+    if(SUM(ProfileEvents['MergeTreeDataWriterBlocksAlreadySorted']) == SUM(ProfileEvents['MergeTreeDataWriterBlocks']), 'Ok', 'Error: some sorted blocks were not detected')
+FROM system.query_log
+WHERE current_database = currentDatabase() AND type = 'QueryFinish'
+    AND query LIKE 'INSERT INTO t_insert_sorted SELECT number%';
+
+SELECT
+    if(SUM(ProfileEvents['MergeTreeDataWriterBlocksAlreadySorted']) == 0, 'Ok', 'Error: unsorted blocks were detected as sorted')
+FROM system.query_log
+WHERE current_database = currentDatabase() AND type = 'QueryFinish'
+    AND query LIKE 'INSERT INTO t_insert_sorted SELECT 1000000%';
+
+DROP TABLE t_insert_sorted;
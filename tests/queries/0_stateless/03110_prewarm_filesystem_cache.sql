@@ -0,0 +1,25 @@
+-- Tags: no-parallel, no-fasttest, no-s3-storage, no-random-settings
+
+DROP TABLE IF EXISTS t_prewarm_cache;
+
+CREATE TABLE t_prewarm_cache (key UInt32, value String)
+ENGINE = MergeTree()
+ORDER BY key
+SETTINGS disk = disk(
+    type = cache,
+    max_size = '128Mi',
+    path = 'prewarm_filesystem_cache/',
+    cache_on_write_operations = 0,
+    disk = 's3_disk');
+
+SYSTEM STOP MERGES t_prewarm_cache;
+
+INSERT INTO t_prewarm_cache SELECT number, toString(number) FROM numbers(10000);
+
+SYSTEM DROP FILESYSTEM CACHE;
+SELECT count() FROM system.filesystem_cache;
+
+SYSTEM PREWARM FILESYSTEM CACHE t_prewarm_cache;
+SELECT count() > 0 FROM system.filesystem_cache;
+
+DROP TABLE t_prewarm_cache;
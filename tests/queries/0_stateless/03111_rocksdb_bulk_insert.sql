@@ -0,0 +1,24 @@
+-- Tags: no-ordinary-database, no-fasttest
+-- Tag no-ordinary-database: Sometimes cannot lock file most likely due to concurrent or adjacent tests, but we don't care how it works in Ordinary database
+-- Tag no-fasttest: In fasttest, ENABLE_LIBRARIES=0, so rocksdb engine is not enabled by default
+
+DROP TABLE IF EXISTS 03111_rocksdb_bulk;
+
+CREATE TABLE 03111_rocksdb_bulk (key UInt64, value String) Engine=EmbeddedRocksDB PRIMARY KEY(key);
+
+SET rocksdb_bulk_insert = 1;
+
+INSERT INTO 03111_rocksdb_bulk SELECT number, format('Hello, world ({})', toString(number)) FROM numbers(10000);
+
+SELECT count() FROM 03111_rocksdb_bulk;
+SELECT value FROM 03111_rocksdb_bulk WHERE key = 9999;
+
+-- The bulk path must keep last-write-wins semantics for duplicate keys within one insert.
+INSERT INTO 03111_rocksdb_bulk SELECT intDiv(number, 2), toString(number) FROM numbers(10);
+SELECT value FROM 03111_rocksdb_bulk WHERE key = 3;
+
+-- And a later ingested file must override previously loaded values.
+INSERT INTO 03111_rocksdb_bulk SELECT number, 'overwritten' FROM numbers(5);
+SELECT value FROM 03111_rocksdb_bulk WHERE key = 2;
+
+DROP TABLE 03111_rocksdb_bulk;
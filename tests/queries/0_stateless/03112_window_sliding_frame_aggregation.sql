@@ -0,0 +1,35 @@
+-- Sliding frames exercise the two-stacks aggregation path in WindowTransform.
+
+SELECT
+    number,
+    min(number) OVER w,
+    max(number) OVER w,
+    sum(number) OVER w,
+    count() OVER w,
+    groupArray(number) OVER w
+FROM numbers(8)
+WINDOW w AS (ORDER BY number ROWS BETWEEN 2 PRECEDING AND CURRENT ROW)
+ORDER BY number;
+
+SELECT
+    number % 2 AS p,
+    number,
+    max(number) OVER (PARTITION BY number % 2 ORDER BY number ROWS BETWEEN 1 PRECEDING AND 1 FOLLOWING) AS m,
+    groupArray(number) OVER (PARTITION BY number % 2 ORDER BY number ROWS BETWEEN 1 PRECEDING AND CURRENT ROW) AS g
+FROM numbers(6)
+ORDER BY p, number;
+
+SELECT
+    number,
+    sum(number) OVER (ORDER BY number RANGE BETWEEN 2 PRECEDING AND CURRENT ROW) AS s
+FROM numbers(6)
+ORDER BY number;
+
+-- The frame can be empty when both boundaries precede the current row.
+SELECT
+    number,
+    sum(number) OVER w AS s,
+    count() OVER w AS c
+FROM numbers(5)
+WINDOW w AS (ORDER BY number ROWS BETWEEN 3 PRECEDING AND 2 PRECEDING)
+ORDER BY number;